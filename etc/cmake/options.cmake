@@ -56,6 +56,10 @@ if(OTBR_DBUS)
     pkg_check_modules(DBUS REQUIRED dbus-1)
     pkg_get_variable(OTBR_DBUS_SYSTEM_BUS_SERVICES_DIR dbus-1 system_bus_services_dir)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DBUS_SERVER=1)
+    set(OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL "1000" CACHE STRING
+        "The period in milliseconds of signaling changed counters over DBus, 0 to disable")
+    target_compile_definitions(otbr-config INTERFACE
+        OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL=${OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL})
 endif()
 
 option(OTBR_FEATURE_FLAGS "Enable feature flags support" OFF)
@@ -40,6 +40,7 @@
 #include "agent/application.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/startup_timeline.hpp"
 #include "utils/infra_link_selector.hpp"
 
 namespace otbr {
@@ -51,7 +52,9 @@ Application::Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
-                         const std::string               &aRestListenAddress)
+                         const std::string               &aRestListenAddress,
+                         Milliseconds                     aTopologyRefreshInterval,
+                         const std::string               &aSrpSnapshotFile)
     : mInterfaceName(aInterfaceName)
 #if __linux__
     , mInfraLinkSelector(aBackboneInterfaceNames)
@@ -78,32 +81,74 @@ Application::Application(const std::string               &aInterfaceName,
 #if OTBR_ENABLE_VENDOR_SERVER
     , mVendorServer(mNcp)
 #endif
+    , mTopologyRefreshInterval(aTopologyRefreshInterval)
+    , mSrpSnapshotFile(aSrpSnapshotFile)
 {
     OTBR_UNUSED_VARIABLE(aRestListenAddress);
+
+#if __linux__
+    mInfraLinkSelector.SetInfraLinkChangedCallback([this](const char *aInfraLinkName) {
+        otbrLogNotice("Infra link changed: %s -> %s", mBackboneInterfaceName, aInfraLinkName);
+        mInfraLinkChanged = true;
+    });
+#endif
 }
 
 void Application::Init(void)
 {
+    StartupTimeline::GetInstance().Start();
+
+    // Acquire the D-Bus name and open the REST listen socket while the RCP is brought up.
+#if OTBR_ENABLE_DBUS_SERVER
+    mDBusAgent.Connect();
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    mRestWebServer.Listen();
+#endif
+
     mNcp.Init();
+    mNcp.GetThreadHelper()->GetTopologyModel().SetRefreshInterval(mTopologyRefreshInterval);
+    mNcp.RegisterResetHandler(
+        [this]() { mNcp.GetThreadHelper()->GetTopologyModel().SetRefreshInterval(mTopologyRefreshInterval); });
+    mNcp.AddThreadStateChangedCallback([this](otChangedFlags aFlags) {
+        if ((aFlags & OT_CHANGED_THREAD_ROLE) && otThreadGetDeviceRole(mNcp.GetInstance()) >= OT_DEVICE_ROLE_CHILD)
+        {
+            StartupTimeline::GetInstance().Record("thread-attached");
+        }
+    });
+    StartupTimeline::GetInstance().Record("ncp-initialized");
 
 #if OTBR_ENABLE_BORDER_AGENT
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mBorderAgent.SetAdvertisingSnapshotFile(mSrpSnapshotFile);
+#endif
     mBorderAgent.Init();
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Init();
 #endif
+#if OTBR_ENABLE_DBUS_SERVER
+    mDBusAgent.Init();
+#endif
+    StartupTimeline::GetInstance().Record("critical-initialized");
+
+    // The controller is processed first in the first mainloop iteration, which brings up the Thread interface
+    // when the network is resumed, so the other subsystems are initialized right after it.
+    mNcp.PostTimerTask(Milliseconds::zero(), [this]() { InitDeferred(); });
+}
+
+void Application::InitDeferred(void)
+{
 #if OTBR_ENABLE_OPENWRT
     mUbusAgent.Init();
 #endif
 #if OTBR_ENABLE_REST_SERVER
     mRestWebServer.Init();
 #endif
-#if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent.Init();
-#endif
 #if OTBR_ENABLE_VENDOR_SERVER
     mVendorServer.Init();
 #endif
+    StartupTimeline::GetInstance().Record("deferred-initialized");
 }
 
 void Application::Deinit(void)
@@ -146,7 +191,7 @@ otbrError Application::Run(void)
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
 
-    while (!sShouldTerminate)
+    while (!sShouldTerminate && !mInfraLinkChanged)
     {
         otbr::MainloopContext mainloop;
         int                   rval;
@@ -166,18 +211,6 @@ otbrError Application::Run(void)
         if (rval >= 0)
         {
             MainloopManager::GetInstance().Process(mainloop);
-
-#if __linux__
-            {
-                const char *newInfraLink = mInfraLinkSelector.Select();
-
-                if (mBackboneInterfaceName != newInfraLink)
-                {
-                    error = OTBR_ERROR_INFRA_LINK_CHANGED;
-                    break;
-                }
-            }
-#endif
         }
         else if (errno != EINTR)
         {
@@ -187,6 +220,11 @@ otbrError Application::Run(void)
         }
     }
 
+    if (error == OTBR_ERROR_NONE && mInfraLinkChanged)
+    {
+        error = OTBR_ERROR_INFRA_LINK_CHANGED;
+    }
+
     return error;
 }
 
@@ -81,21 +81,30 @@ public:
     /**
      * This constructor initializes the Application instance.
      *
-     * @param[in] aInterfaceName         Name of the Thread network interface.
-     * @param[in] aBackboneInterfaceName Name of the backbone network interface.
-     * @param[in] aRadioUrls             The radio URLs (can be IEEE802.15.4 or TREL radio).
-     * @param[in] aEnableAutoAttach      Whether or not to automatically attach to the saved network.
+     * @param[in] aInterfaceName            Name of the Thread network interface.
+     * @param[in] aBackboneInterfaceName    Name of the backbone network interface.
+     * @param[in] aRadioUrls                The radio URLs (can be IEEE802.15.4 or TREL radio).
+     * @param[in] aEnableAutoAttach         Whether or not to automatically attach to the saved network.
+     * @param[in] aRestListenAddress        The address the REST server listens on.
+     * @param[in] aTopologyRefreshInterval  The interval to refresh the network topology, zero to disable.
+     * @param[in] aSrpSnapshotFile          The file which persists the advertised SRP hosts and services, empty to
+     *                                      disable.
      *
      */
     explicit Application(const std::string               &aInterfaceName,
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
                          bool                             aEnableAutoAttach,
-                         const std::string               &aRestListenAddress);
+                         const std::string               &aRestListenAddress,
+                         Milliseconds                     aTopologyRefreshInterval,
+                         const std::string               &aSrpSnapshotFile);
 
     /**
      * This method initializes the Application instance.
      *
+     * Only the subsystems on the critical path to the first packet are initialized by this method. The
+     * others are initialized after the first mainloop iteration.
+     *
      */
     void Init(void);
 
@@ -108,8 +117,9 @@ public:
     /**
      * This method runs the application until exit.
      *
-     * @retval OTBR_ERROR_NONE  The application exited without any error.
-     * @retval OTBR_ERROR_ERRNO The application exited with some system error.
+     * @retval OTBR_ERROR_NONE               The application exited without any error.
+     * @retval OTBR_ERROR_ERRNO              The application exited with some system error.
+     * @retval OTBR_ERROR_INFRA_LINK_CHANGED The infrastructure link selection has changed.
      *
      */
     otbrError Run(void);
@@ -120,6 +130,8 @@ private:
 
     static void HandleSignal(int aSignal);
 
+    void InitDeferred(void);
+
     std::string mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
@@ -144,6 +156,9 @@ private:
 #if OTBR_ENABLE_VENDOR_SERVER
     vendor::VendorServer mVendorServer;
 #endif
+    bool         mInfraLinkChanged = false;
+    Milliseconds mTopologyRefreshInterval;
+    std::string  mSrpSnapshotFile;
 
     static std::atomic_bool sShouldTerminate;
 };
@@ -57,6 +57,7 @@
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "utils/topology_model.hpp"
 
 static const char kSyslogIdent[]          = "otbr-agent";
 static const char kDefaultInterfaceName[] = "wpan0";
@@ -73,6 +74,8 @@ enum
     OTBR_OPT_RADIO_VERSION,
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
+    OTBR_OPT_TOPOLOGY_REFRESH_INTERVAL,
+    OTBR_OPT_SRP_SNAPSHOT_FILE,
 };
 
 static jmp_buf            sResetJump;
@@ -89,6 +92,8 @@ static const struct option kOptions[] = {
     {"radio-version", no_argument, nullptr, OTBR_OPT_RADIO_VERSION},
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
+    {"topology-refresh-interval", required_argument, nullptr, OTBR_OPT_TOPOLOGY_REFRESH_INTERVAL},
+    {"srp-snapshot-file", required_argument, nullptr, OTBR_OPT_SRP_SNAPSHOT_FILE},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -130,9 +135,11 @@ static std::vector<char *> AppendAutoAttachDisableArg(int argc, char *argv[])
 static void PrintHelp(const char *aProgramName)
 {
     fprintf(stderr,
-            "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [--auto-attach[=0/1]] RADIO_URL "
-            "[RADIO_URL]\n"
-            "    --auto-attach defaults to 1\n",
+            "Usage: %s [-I interfaceName] [-B backboneIfName] [-d DEBUG_LEVEL] [-v] [--auto-attach[=0/1]] "
+            "[--topology-refresh-interval=SECONDS] [--srp-snapshot-file=PATH] RADIO_URL [RADIO_URL]\n"
+            "    --auto-attach defaults to 1\n"
+            "    --topology-refresh-interval defaults to 60, 0 disables the background topology refresh\n"
+            "    --srp-snapshot-file restores the advertised SRP hosts and services across restarts\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
@@ -192,9 +199,11 @@ static int realmain(int argc, char *argv[])
     bool                      printRadioVersion = false;
     bool                      enableAutoAttach  = true;
     const char               *restListenAddress = "";
+    const char               *srpSnapshotFile   = "";
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
+    otbr::Milliseconds        topologyRefreshInterval = otbr::agent::TopologyModel::kDefaultRefreshInterval;
 
     std::set_new_handler(OnAllocateFailed);
 
@@ -250,6 +259,16 @@ static int realmain(int argc, char *argv[])
             restListenAddress = optarg;
             break;
 
+        case OTBR_OPT_TOPOLOGY_REFRESH_INTERVAL:
+            VerifyOrExit(ParseInteger(optarg, parseResult), ret = EXIT_FAILURE);
+            VerifyOrExit(parseResult >= 0, ret = EXIT_FAILURE);
+            topologyRefreshInterval = std::chrono::duration_cast<otbr::Milliseconds>(otbr::Seconds(parseResult));
+            break;
+
+        case OTBR_OPT_SRP_SNAPSHOT_FILE:
+            srpSnapshotFile = optarg;
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -280,7 +299,8 @@ static int realmain(int argc, char *argv[])
     }
 
     {
-        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress);
+        otbr::Application app(interfaceName, backboneInterfaceNames, radioUrls, enableAutoAttach, restListenAddress,
+                              topologyRefreshInterval, srpSnapshotFile);
 
         gApp = &app;
         app.Init();
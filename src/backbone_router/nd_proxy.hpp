@@ -44,8 +44,8 @@
 #include <libnetfilter_queue/libnetfilter_queue.h>
 #include <map>
 #include <netinet/in.h>
-#include <set>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include <openthread/backbone_router_ftd.h>
@@ -153,7 +153,7 @@ private:
 
     otbr::Ncp::ControllerOpenThread &mNcp;
     std::string                      mBackboneInterfaceName;
-    std::set<Ip6Address>             mNdProxySet;
+    std::unordered_set<Ip6Address>   mNdProxySet;
     uint32_t                         mBackboneIfIndex;
     int                              mIcmp6RawSock;
     int                              mUnicastNsQueueSock;
@@ -111,6 +111,16 @@ public:
      */
     Mdns::Publisher &GetPublisher() { return *mPublisher; }
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    /**
+     * This method sets the file which persists the SRP hosts and services advertised by the border agent.
+     *
+     * @param[in] aPath  The path of the snapshot file, an empty path disables the persistence.
+     *
+     */
+    void SetAdvertisingSnapshotFile(const std::string &aPath) { mAdvertisingProxy.SetSnapshotFile(aPath); }
+#endif
+
 private:
     void Start(void);
     void Stop(void);
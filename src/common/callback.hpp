@@ -29,9 +29,10 @@
 #ifndef OTBR_COMMON_CALLBACK_HPP_
 #define OTBR_COMMON_CALLBACK_HPP_
 
-#include <functional>
 #include <type_traits>
 
+#include "common/move_only_function.hpp"
+
 namespace otbr {
 
 template <class T> class OnceCallback;
@@ -56,7 +57,8 @@ template <typename R, typename... Args> class OnceCallback<R(Args...)>
 public:
     // Constructs a new `OnceCallback` instance with a callable.
     //
-    // This constructor is for matching std::function<> and lambda and the
+    // This constructor is for matching std::function<>, lambda and move-only
+    // callables, small ones are stored without heap allocation. The
     // `std::enable_if_t` check is only required for working around gcc 4.x
     // compiling issue which trying to instantiate this template constructor
     // for use cases like `::mOnceCallback(aOnceCallback)`.
@@ -89,7 +91,7 @@ public:
     bool IsNull() const { return mFunc == nullptr; }
 
 private:
-    std::function<R(Args...)> mFunc;
+    MoveOnlyFunction<R(Args...)> mFunc;
 };
 
 } // namespace otbr
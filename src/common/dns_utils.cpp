@@ -28,68 +28,123 @@
 
 #include "common/dns_utils.hpp"
 
-#include <assert.h>
-
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+static char ToLowerAscii(char aChar)
 {
-    return !aName.empty() && aName.back() == '.';
+    return ('A' <= aChar && aChar <= 'Z') ? static_cast<char>(aChar - 'A' + 'a') : aChar;
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+// Finds the last "._tcp" or "._udp" label which is followed by a dot or ends the name.
+static size_t FindTransportLabel(otbr::StringView aName, const char *aTransport)
+{
+    size_t pos = otbr::StringView::npos;
+
+    for (size_t i = aName.size(); i >= 5; i--)
+    {
+        size_t start = i - 5;
+
+        if (aName[start] == '.' && memcmp(aName.data() + start + 1, aTransport, 4) == 0 &&
+            (i == aName.size() || aName[i] == '.'))
+        {
+            pos = start;
+            break;
+        }
+    }
+
+    return pos;
+}
+
+bool DnsLabelsEqual(otbr::StringView aLabel1, otbr::StringView aLabel2)
+{
+    bool equal = (aLabel1.size() == aLabel2.size());
+
+    for (size_t i = 0; equal && i < aLabel1.size(); i++)
+    {
+        equal = (ToLowerAscii(aLabel1[i]) == ToLowerAscii(aLabel2[i]));
+    }
+
+    return equal;
+}
+
+DnsNameView SplitFullDnsNameView(otbr::StringView aName)
 {
     size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    DnsNameView nameView;
+    size_t      dotPos;
 
-    if (!NameEndsWithDot(fullName))
+    if (!aName.empty() && aName[aName.size() - 1] == '.')
     {
-        fullName += '.';
+        aName.remove_suffix(1);
     }
 
-    transportPos = fullName.rfind("._udp.");
+    transportPos = FindTransportLabel(aName, "_udp");
 
-    if (transportPos == std::string::npos)
+    if (transportPos == otbr::StringView::npos)
     {
-        transportPos = fullName.rfind("._tcp.");
+        transportPos = FindTransportLabel(aName, "_tcp");
     }
 
-    if (transportPos == std::string::npos)
+    if (transportPos == otbr::StringView::npos)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
-
-        assert(dotPos != std::string::npos);
+        dotPos = aName.find('.');
 
-        // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        nameView.mHostName = aName.substr(0, dotPos);
+        nameView.mDomain   = (dotPos == otbr::StringView::npos) ? otbr::StringView() : aName.substr(dotPos + 1);
     }
     else
     {
-        // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        // service or service instance, 5 is the length of "._tcp" or "._udp"
+        dotPos = otbr::StringView::npos;
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        for (size_t i = transportPos; i > 0; i--)
+        {
+            if (aName[i - 1] == '.')
+            {
+                dotPos = i - 1;
+                break;
+            }
+        }
+
+        nameView.mDomain = (transportPos + 5 < aName.size()) ? aName.substr(transportPos + 6) : otbr::StringView();
 
-        if (dotPos == std::string::npos)
+        if (dotPos == otbr::StringView::npos)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            nameView.mServiceName = aName.substr(0, transportPos + 5);
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            nameView.mInstanceName = aName.substr(0, dotPos);
+            nameView.mServiceName  = aName.substr(dotPos + 1, transportPos + 4 - dotPos);
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+    return nameView;
+}
+
+static std::string DomainToString(otbr::StringView aDomain)
+{
+    std::string domain;
+
+    domain.reserve(aDomain.size() + 1);
+    domain.append(aDomain.data(), aDomain.size());
+    domain += '.';
+
+    return domain;
+}
+
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    DnsNameView nameView = SplitFullDnsNameView(aName);
+    DnsNameInfo nameInfo;
+
+    nameInfo.mInstanceName = nameView.mInstanceName.ToString();
+    nameInfo.mServiceName  = nameView.mServiceName.ToString();
+    nameInfo.mHostName     = nameView.mHostName.ToString();
+    nameInfo.mDomain       = DomainToString(nameView.mDomain);
 
     return nameInfo;
 }
@@ -100,13 +155,13 @@ otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string       &aDomain)
 {
     otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
 
-    VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(nameView.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    aInstanceName.assign(nameView.mInstanceName.data(), nameView.mInstanceName.size());
+    aType.assign(nameView.mServiceName.data(), nameView.mServiceName.size());
+    aDomain = DomainToString(nameView.mDomain);
 
 exit:
     return error;
@@ -115,12 +170,12 @@ exit:
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
     otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
 
-    VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(nameView.IsService(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    aType.assign(nameView.mServiceName.data(), nameView.mServiceName.size());
+    aDomain = DomainToString(nameView.mDomain);
 
 exit:
     return error;
@@ -129,13 +184,98 @@ exit:
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
     otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    DnsNameView nameView = SplitFullDnsNameView(aFullName);
+
+    VerifyOrExit(nameView.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+
+    aHostName.assign(nameView.mHostName.data(), nameView.mHostName.size());
+    aDomain = DomainToString(nameView.mDomain);
+
+exit:
+    return error;
+}
+
+otbrError DnsName::AppendLabel(otbr::StringView aLabel)
+{
+    otbrError error = OTBR_ERROR_NONE;
 
-    VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(!aLabel.empty() && aLabel.size() <= kMaxLabelLength, error = OTBR_ERROR_INVALID_ARGS);
+    // The length byte, the label and the root label must fit in the buffer.
+    VerifyOrExit(mLength + aLabel.size() + 2 <= kMaxLength, error = OTBR_ERROR_INVALID_ARGS);
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    mBuffer[mLength++] = static_cast<uint8_t>(aLabel.size());
+    memcpy(&mBuffer[mLength], aLabel.data(), aLabel.size());
+    mLength += static_cast<uint8_t>(aLabel.size());
+    mBuffer[mLength] = 0;
 
 exit:
     return error;
 }
+
+otbrError DnsName::AppendName(otbr::StringView aName)
+{
+    otbrError error  = OTBR_ERROR_NONE;
+    uint8_t   length = mLength;
+
+    if (!aName.empty() && aName[aName.size() - 1] == '.')
+    {
+        aName.remove_suffix(1);
+    }
+
+    while (!aName.empty())
+    {
+        size_t dotPos = aName.find('.');
+
+        SuccessOrExit(error = AppendLabel(aName.substr(0, dotPos)));
+        aName.remove_prefix(dotPos == otbr::StringView::npos ? aName.size() : dotPos + 1);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        // Leaves the name unchanged on failure.
+        mLength          = length;
+        mBuffer[mLength] = 0;
+    }
+
+    return error;
+}
+
+uint8_t DnsName::GetLabelCount(void) const
+{
+    uint8_t count = 0;
+
+    for (uint8_t pos = 0; pos < mLength; pos += mBuffer[pos] + 1)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+std::string DnsName::ToString(void) const
+{
+    std::string name;
+
+    name.reserve(mLength + 1);
+
+    for (uint8_t pos = 0; pos < mLength; pos += mBuffer[pos] + 1)
+    {
+        name.append(reinterpret_cast<const char *>(&mBuffer[pos + 1]), mBuffer[pos]);
+        name += '.';
+    }
+
+    if (name.empty())
+    {
+        name = ".";
+    }
+
+    return name;
+}
+
+bool DnsName::operator==(const DnsName &aOther) const
+{
+    // The label lengths are compared as part of the bytes, and they are never letters.
+    return DnsLabelsEqual(otbr::StringView(reinterpret_cast<const char *>(mBuffer), mLength),
+                          otbr::StringView(reinterpret_cast<const char *>(aOther.mBuffer), aOther.mLength));
+}
@@ -34,6 +34,7 @@
 #ifndef OTBR_COMMON_DNS_UTILS_HPP_
 #define OTBR_COMMON_DNS_UTILS_HPP_
 
+#include "common/string_view.hpp"
 #include "common/types.hpp"
 
 /**
@@ -74,6 +75,175 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This structure represents DNS Name information as views into the full DNS name, so splitting a name doesn't copy it.
+ *
+ * The views are only valid as long as the full DNS name is.
+ *
+ * @sa SplitFullDnsNameView
+ *
+ */
+struct DnsNameView
+{
+    otbr::StringView mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    otbr::StringView mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    otbr::StringView mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    otbr::StringView mDomain;       ///< Domain name without the trailing dot, which is empty for the root domain.
+
+    /**
+     * This method returns if the DNS name is a service instance.
+     *
+     * @returns Whether the DNS name is a service instance.
+     *
+     */
+    bool IsServiceInstance(void) const { return !mInstanceName.empty(); };
+
+    /**
+     * This method returns if the DNS name is a service.
+     *
+     * @returns Whether the DNS name is a service.
+     *
+     */
+    bool IsService(void) const { return !mServiceName.empty() && mInstanceName.empty(); }
+
+    /**
+     * This method returns if the DNS name is a host.
+     *
+     * @returns Whether the DNS name is a host.
+     *
+     */
+    bool IsHost(void) const { return mServiceName.empty(); }
+};
+
+/**
+ * This class represents a DNS name in the wire format (RFC 1035 section 3.1).
+ *
+ * The name is stored inline, so building and comparing names never allocates memory.
+ *
+ */
+class DnsName
+{
+public:
+    enum : uint8_t
+    {
+        kMaxLength      = 255, ///< The maximum length of a DNS name in the wire format, including the root label.
+        kMaxLabelLength = 63,  ///< The maximum length of a DNS label.
+    };
+
+    /**
+     * This constructor initializes the DNS name as the root domain.
+     *
+     */
+    DnsName(void)
+        : mLength(0)
+    {
+        mBuffer[0] = 0;
+    }
+
+    /**
+     * This method appends a label to the DNS name.
+     *
+     * The label is appended as is, so it may contain dots (e.g. a service instance name).
+     *
+     * @param[in] aLabel  The label to append.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully appended the label.
+     * @retval OTBR_ERROR_INVALID_ARGS  The label is empty or too long, or the name would become too long.
+     *
+     */
+    otbrError AppendLabel(otbr::StringView aLabel);
+
+    /**
+     * This method appends the dot-separated labels of a name to the DNS name.
+     *
+     * @param[in] aName  The name to append, the trailing dot is optional.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully appended the labels.
+     * @retval OTBR_ERROR_INVALID_ARGS  A label is empty or too long, or the name would become too long.
+     *
+     */
+    otbrError AppendName(otbr::StringView aName);
+
+    /**
+     * This method returns the DNS name in the wire format.
+     *
+     * @returns A pointer to the DNS name, terminated by the root label.
+     *
+     */
+    const uint8_t *GetData(void) const { return mBuffer; }
+
+    /**
+     * This method returns the length of the DNS name in the wire format.
+     *
+     * @returns The length of the DNS name, including the root label.
+     *
+     */
+    size_t GetLength(void) const { return mLength + 1u; }
+
+    /**
+     * This method returns the number of labels, excluding the root label.
+     *
+     * @returns The number of labels.
+     *
+     */
+    uint8_t GetLabelCount(void) const;
+
+    /**
+     * This method returns the DNS name in the dot-separated format.
+     *
+     * @returns The DNS name with a trailing dot.
+     *
+     */
+    std::string ToString(void) const;
+
+    /**
+     * This method compares two DNS names label by label in a case-insensitive manner.
+     *
+     * @param[in] aOther  The DNS name to compare with.
+     *
+     * @returns Whether the two DNS names are equal.
+     *
+     */
+    bool operator==(const DnsName &aOther) const;
+
+    /**
+     * This method compares two DNS names label by label in a case-insensitive manner.
+     *
+     * @param[in] aOther  The DNS name to compare with.
+     *
+     * @returns Whether the two DNS names are not equal.
+     *
+     */
+    bool operator!=(const DnsName &aOther) const { return !(*this == aOther); }
+
+private:
+    uint8_t mBuffer[kMaxLength];
+    uint8_t mLength; // The length of the labels, excluding the root label.
+};
+
+/**
+ * This method compares two DNS labels (or names) in a case-insensitive manner without allocating memory.
+ *
+ * @param[in] aLabel1  The first label.
+ * @param[in] aLabel2  The second label.
+ *
+ * @returns Whether the two labels are equal.
+ *
+ */
+bool DnsLabelsEqual(otbr::StringView aLabel1, otbr::StringView aLabel2);
+
+/**
+ * This method splits a full DNS name into name components without copying it.
+ *
+ * @param[in] aName  The full DNS name to dissect.
+ *
+ * @returns A `DnsNameView` structure containing views of the DNS name components.
+ *
+ * @sa DnsNameView
+ *
+ */
+DnsNameView SplitFullDnsNameView(otbr::StringView aName);
+
 /**
  * This method splits a full DNS name into name components.
  *
@@ -31,7 +31,9 @@
 
 namespace otbr {
 
-MainloopProcessor::MainloopProcessor(void)
+MainloopProcessor::MainloopProcessor(Priority aPriority)
+    : mPriority(aPriority)
+    , mDeferredWorkCount(0)
 {
     MainloopManager::GetInstance().AddMainloopProcessor(this);
 }
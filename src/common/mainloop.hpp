@@ -36,8 +36,13 @@
 
 #include <openthread-br/config.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <openthread/openthread-system.h>
 
+#include <stdint.h>
+
 namespace otbr {
 
 /**
@@ -54,10 +59,54 @@ using MainloopContext = otSysMainloopContext;
 class MainloopProcessor
 {
 public:
-    MainloopProcessor(void);
+    /**
+     * This enumeration defines the priorities of mainloop processors.
+     *
+     * Processors of a higher priority are updated and processed first. Processors of the same
+     * priority are processed in the order they are created.
+     *
+     */
+    enum Priority : uint8_t
+    {
+        kPriorityHigh   = 0, ///< The OpenThread controller, which drives the spinel link and tasklets.
+        kPriorityNormal = 1, ///< All the other processors.
+    };
+
+    /**
+     * The constructor of a mainloop processor, which registers it to the mainloop manager.
+     *
+     * @param[in] aPriority  The priority of the mainloop processor.
+     *
+     */
+    explicit MainloopProcessor(Priority aPriority = kPriorityNormal);
 
     virtual ~MainloopProcessor(void);
 
+    /**
+     * This method returns the priority of the mainloop processor.
+     *
+     * @returns The priority of the mainloop processor.
+     *
+     */
+    Priority GetPriority(void) const { return mPriority; }
+
+    /**
+     * This method returns the name of the mainloop processor, which identifies it in the logs.
+     *
+     * @returns The name of the mainloop processor.
+     *
+     */
+    virtual const char *GetName(void) const { return "MainloopProcessor"; }
+
+    /**
+     * This method returns the number of mainloop iterations in which the processor used up its
+     * budget and deferred work to the next iteration.
+     *
+     * @returns The number of times the processor deferred work.
+     *
+     */
+    uint32_t GetDeferredWorkCount(void) const { return mDeferredWorkCount; }
+
     /**
      * This method updates the mainloop context.
      *
@@ -73,6 +122,71 @@ public:
      *
      */
     virtual void Process(const MainloopContext &aMainloop) = 0;
+
+protected:
+    /**
+     * This method does units of work until there is no work left or the budget is used up.
+     *
+     * A processor which does a variable amount of work in `Process()` limits it to a budget so that
+     * it does not delay the OpenThread controller, and leaves the rest to the next iteration, which is
+     * counted as deferred work.
+     *
+     * @param[in] aBudget       The maximum number of units of work.
+     * @param[in] aProcessOne   The function which does a unit of work and returns whether there is work left.
+     *
+     * @returns Whether there is work left for the next iteration.
+     *
+     */
+    template <typename ProcessOneFunc> bool ProcessWithinBudget(uint32_t aBudget, ProcessOneFunc &&aProcessOne)
+    {
+        bool workLeft = true;
+
+        for (uint32_t i = 0; i < aBudget && workLeft; i++)
+        {
+            workLeft = aProcessOne();
+        }
+
+        if (workLeft)
+        {
+            mDeferredWorkCount++;
+        }
+
+        return workLeft;
+    }
+
+    /**
+     * This method limits the ready items to be processed in a mainloop iteration to a budget.
+     *
+     * The items are taken from a rotating offset, so that the items at the end are not starved by
+     * busy items at the beginning. Leaving items to the next iteration is counted as deferred work.
+     *
+     * @param[in,out] aItems       The ready items, which are limited to at most @p aBudget items.
+     * @param[in]     aBudget      The maximum number of items.
+     * @param[in,out] aNextOffset  The offset to take the items from, which is advanced past the taken items.
+     *
+     * @returns Whether some items are left for the next iteration.
+     *
+     */
+    template <typename Item> bool TakeWithinBudget(std::vector<Item> &aItems, size_t aBudget, size_t &aNextOffset)
+    {
+        bool   itemsLeft = aItems.size() > aBudget;
+        size_t offset;
+
+        if (itemsLeft)
+        {
+            offset = aNextOffset % aItems.size();
+            std::rotate(aItems.begin(), aItems.begin() + offset, aItems.end());
+            aItems.resize(aBudget);
+            aNextOffset = offset + aBudget;
+            mDeferredWorkCount++;
+        }
+
+        return itemsLeft;
+    }
+
+private:
+    const Priority mPriority;
+    uint32_t       mDeferredWorkCount;
 };
 
 } // namespace otbr
@@ -25,21 +25,36 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MAINLOOP"
+
 #include <assert.h>
 
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+constexpr Milliseconds MainloopManager::kDeferredWorkLogInterval;
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
+    auto iter = mMainloopProcessorList.begin();
+
     assert(aMainloopProcessor != nullptr);
-    mMainloopProcessorList.emplace_back(aMainloopProcessor);
+
+    // Keep the list sorted by priority, and in the order of creation within a priority.
+    while (iter != mMainloopProcessorList.end() && (*iter)->GetPriority() <= aMainloopProcessor->GetPriority())
+    {
+        ++iter;
+    }
+
+    mMainloopProcessorList.insert(iter, aMainloopProcessor);
 }
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     mMainloopProcessorList.remove(aMainloopProcessor);
+    mLoggedDeferredWorkCounts.erase(aMainloopProcessor);
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
@@ -56,5 +71,31 @@ void MainloopManager::Process(const MainloopContext &aMainloop)
     {
         mainloopProcessor->Process(aMainloop);
     }
+
+    LogDeferredWork();
+}
+
+void MainloopManager::LogDeferredWork(void)
+{
+    Timepoint now = Clock::now();
+
+    VerifyOrExit(now >= mNextDeferredWorkLogTime);
+    mNextDeferredWorkLogTime = now + kDeferredWorkLogInterval;
+
+    for (const MainloopProcessor *mainloopProcessor : mMainloopProcessorList)
+    {
+        uint32_t &loggedCount = mLoggedDeferredWorkCounts[mainloopProcessor];
+        uint32_t  count       = mainloopProcessor->GetDeferredWorkCount();
+
+        if (count != loggedCount)
+        {
+            otbrLogInfo("%s deferred work in %u mainloop iterations, %u in total", mainloopProcessor->GetName(),
+                        count - loggedCount, count);
+            loggedCount = count;
+        }
+    }
+
+exit:
+    return;
 }
 } // namespace otbr
@@ -39,9 +39,11 @@
 #include <openthread/openthread-system.h>
 
 #include <list>
+#include <map>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 namespace otbr {
@@ -72,6 +74,8 @@ public:
     /**
      * This method adds a mainloop processors to the mainloop managger.
      *
+     * The processor is added after all the processors of the same or a higher priority.
+     *
      * @param[in] aMainloopProcessor  A pointer to the mainloop processor.
      *
      */
@@ -94,7 +98,9 @@ public:
     void Update(MainloopContext &aMainloop);
 
     /**
-     * This method processes mainloop events of all mainloop processors.
+     * This method processes mainloop events of all mainloop processors, in the order of priority.
+     *
+     * The processors which deferred work since the last log are logged periodically.
      *
      * @param[in] aMainloop  A reference to the mainloop context.
      *
@@ -102,7 +108,13 @@ public:
     void Process(const MainloopContext &aMainloop);
 
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+    static constexpr Milliseconds kDeferredWorkLogInterval = Milliseconds(60000);
+
+    void LogDeferredWork(void);
+
+    std::list<MainloopProcessor *>                mMainloopProcessorList;
+    std::map<const MainloopProcessor *, uint32_t> mLoggedDeferredWorkCounts;
+    Timepoint                                     mNextDeferredWorkLogTime;
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,243 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for a move-only callable wrapper with inline storage.
+ */
+
+#ifndef OTBR_COMMON_MOVE_ONLY_FUNCTION_HPP_
+#define OTBR_COMMON_MOVE_ONLY_FUNCTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace otbr {
+
+template <class T> class MoveOnlyFunction;
+
+/**
+ * This class implements a move-only wrapper of a callable, similar to `std::function`.
+ *
+ * Unlike `std::function`, the callable doesn't have to be copyable, and a callable which fits in `kInlineSize`
+ * bytes is stored inside the wrapper instead of on the heap, so it is neither allocated nor freed when the wrapper is
+ * created, moved or destroyed. It doesn't use RTTI either.
+ *
+ */
+template <typename R, typename... Args> class MoveOnlyFunction<R(Args...)>
+{
+public:
+    enum : size_t
+    {
+        kInlineSize = 64, ///< The size of a callable which is stored inline, covers `this` with a few strings.
+    };
+
+    /**
+     * This constructor creates an empty wrapper.
+     *
+     */
+    MoveOnlyFunction(void)
+        : mOps(nullptr)
+    {
+    }
+
+    /**
+     * This constructor creates an empty wrapper.
+     *
+     */
+    MoveOnlyFunction(std::nullptr_t)
+        : MoveOnlyFunction()
+    {
+    }
+
+    /**
+     * This constructor creates a wrapper of a callable.
+     *
+     * @param[in] aFunc  The callable, which is moved or copied into the wrapper.
+     *
+     */
+    template <typename F,
+              typename Func = typename std::decay<F>::type,
+              typename      = typename std::enable_if<!std::is_same<Func, MoveOnlyFunction>::value &&
+                                                 !std::is_same<Func, std::nullptr_t>::value>::type>
+    MoveOnlyFunction(F &&aFunc)
+        : MoveOnlyFunction()
+    {
+        if (!IsNullCallable(aFunc))
+        {
+            Manager<Func>::Create(mStorage, std::forward<F>(aFunc));
+            mOps = &Manager<Func>::kOps;
+        }
+    }
+
+    MoveOnlyFunction(MoveOnlyFunction &&aOther)
+        : MoveOnlyFunction()
+    {
+        MoveFrom(aOther);
+    }
+
+    MoveOnlyFunction &operator=(MoveOnlyFunction &&aOther)
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(aOther);
+        }
+
+        return *this;
+    }
+
+    MoveOnlyFunction &operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    MoveOnlyFunction(const MoveOnlyFunction &)            = delete;
+    MoveOnlyFunction &operator=(const MoveOnlyFunction &) = delete;
+
+    ~MoveOnlyFunction(void) { Reset(); }
+
+    /**
+     * This method invokes the callable.
+     *
+     * The wrapper must not be empty.
+     *
+     */
+    R operator()(Args... aArgs) const
+    {
+        return mOps->mInvoke(const_cast<Storage &>(mStorage), std::forward<Args>(aArgs)...);
+    }
+
+    /**
+     * This method returns whether the wrapper has a callable.
+     *
+     */
+    explicit operator bool(void) const { return mOps != nullptr; }
+
+    friend bool operator==(const MoveOnlyFunction &aFunc, std::nullptr_t) { return aFunc.mOps == nullptr; }
+    friend bool operator==(std::nullptr_t, const MoveOnlyFunction &aFunc) { return aFunc.mOps == nullptr; }
+    friend bool operator!=(const MoveOnlyFunction &aFunc, std::nullptr_t) { return aFunc.mOps != nullptr; }
+    friend bool operator!=(std::nullptr_t, const MoveOnlyFunction &aFunc) { return aFunc.mOps != nullptr; }
+
+private:
+    typedef typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type Storage;
+
+    struct Ops
+    {
+        R (*mInvoke)(Storage &aStorage, Args &&...aArgs);
+        void (*mMove)(Storage &aDst, Storage &aSrc); // Moves the callable and destroys the source.
+        void (*mDestroy)(Storage &aStorage);
+    };
+
+    template <typename Func, bool kIsInline = (sizeof(Func) <= sizeof(Storage) &&
+                                               alignof(Storage) % alignof(Func) == 0 &&
+                                               std::is_nothrow_move_constructible<Func>::value)>
+    struct Manager;
+
+    template <typename Func> struct Manager<Func, true>
+    {
+        template <typename F> static void Create(Storage &aStorage, F &&aFunc)
+        {
+            ::new (&aStorage) Func(std::forward<F>(aFunc));
+        }
+
+        static Func &Get(Storage &aStorage) { return *reinterpret_cast<Func *>(&aStorage); }
+
+        static R Invoke(Storage &aStorage, Args &&...aArgs) { return Get(aStorage)(std::forward<Args>(aArgs)...); }
+
+        static void Move(Storage &aDst, Storage &aSrc)
+        {
+            ::new (&aDst) Func(std::move(Get(aSrc)));
+            Get(aSrc).~Func();
+        }
+
+        static void Destroy(Storage &aStorage) { Get(aStorage).~Func(); }
+
+        static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+    };
+
+    template <typename Func> struct Manager<Func, false>
+    {
+        template <typename F> static void Create(Storage &aStorage, F &&aFunc)
+        {
+            ::new (&aStorage) Func *(new Func(std::forward<F>(aFunc)));
+        }
+
+        static Func *&Get(Storage &aStorage) { return *reinterpret_cast<Func **>(&aStorage); }
+
+        static R Invoke(Storage &aStorage, Args &&...aArgs) { return (*Get(aStorage))(std::forward<Args>(aArgs)...); }
+
+        static void Move(Storage &aDst, Storage &aSrc) { ::new (&aDst) Func *(Get(aSrc)); }
+
+        static void Destroy(Storage &aStorage) { delete Get(aStorage); }
+
+        static constexpr Ops kOps = {&Invoke, &Move, &Destroy};
+    };
+
+    template <typename F> static bool IsNullCallable(const F &) { return false; }
+    template <typename T> static bool IsNullCallable(T *aFunc) { return aFunc == nullptr; }
+    template <typename Sig> static bool IsNullCallable(const std::function<Sig> &aFunc) { return !aFunc; }
+
+    void MoveFrom(MoveOnlyFunction &aOther)
+    {
+        if (aOther.mOps != nullptr)
+        {
+            aOther.mOps->mMove(mStorage, aOther.mStorage);
+            mOps        = aOther.mOps;
+            aOther.mOps = nullptr;
+        }
+    }
+
+    void Reset(void)
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mDestroy(mStorage);
+            mOps = nullptr;
+        }
+    }
+
+    Storage    mStorage;
+    const Ops *mOps;
+};
+
+template <typename R, typename... Args>
+template <typename Func>
+constexpr typename MoveOnlyFunction<R(Args...)>::Ops MoveOnlyFunction<R(Args...)>::Manager<Func, true>::kOps;
+
+template <typename R, typename... Args>
+template <typename Func>
+constexpr typename MoveOnlyFunction<R(Args...)>::Ops MoveOnlyFunction<R(Args...)>::Manager<Func, false>::kOps;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MOVE_ONLY_FUNCTION_HPP_
@@ -0,0 +1,78 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ * This file implements the Startup Timeline.
+ */
+
+#define OTBR_LOG_TAG "APP"
+
+#include "common/startup_timeline.hpp"
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupTimeline::StartupTimeline(void)
+    : mStartTime(Clock::now())
+{
+}
+
+void StartupTimeline::Start(void)
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    mStartTime = Clock::now();
+    mMilestones.clear();
+}
+
+void StartupTimeline::Record(const char *aName)
+{
+    std::lock_guard<std::mutex> _(mMutex);
+    Milliseconds                elapsed = std::chrono::duration_cast<Milliseconds>(Clock::now() - mStartTime);
+
+    for (const Milestone &milestone : mMilestones)
+    {
+        VerifyOrExit(milestone.mName != aName);
+    }
+
+    mMilestones.push_back({aName, elapsed});
+    otbrLogInfo("Startup milestone %s reached in %lld ms", aName, static_cast<long long>(elapsed.count()));
+
+exit:
+    return;
+}
+
+std::vector<StartupTimeline::Milestone> StartupTimeline::GetMilestones(void) const
+{
+    std::lock_guard<std::mutex> _(mMutex);
+
+    return mMilestones;
+}
+
+} // namespace otbr
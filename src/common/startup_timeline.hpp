@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ * This file defines the Startup Timeline that records the startup milestones of the agent.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_TIMELINE_HPP_
+#define OTBR_COMMON_STARTUP_TIMELINE_HPP_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the Startup Timeline which records when each startup milestone is reached.
+ *
+ * The timeline shows where the time to the first packet goes after the agent is (re)started. It is
+ * safe to record milestones in different threads concurrently.
+ *
+ */
+class StartupTimeline : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a startup milestone.
+     *
+     */
+    struct Milestone
+    {
+        std::string  mName;    ///< The name of the milestone.
+        Milliseconds mElapsed; ///< The time from the start to the milestone.
+    };
+
+    /**
+     * This method returns the singleton instance of the startup timeline.
+     *
+     */
+    static StartupTimeline &GetInstance(void)
+    {
+        static StartupTimeline sStartupTimeline;
+        return sStartupTimeline;
+    }
+
+    /**
+     * This method starts the timeline, and clears the milestones recorded before.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method records a milestone.
+     *
+     * Only the first time a milestone is reached is recorded, later records of the same milestone are ignored.
+     *
+     * @param[in] aName  The name of the milestone.
+     *
+     */
+    void Record(const char *aName);
+
+    /**
+     * This method returns the recorded milestones, in the order they are reached.
+     *
+     * @returns The recorded milestones.
+     *
+     */
+    std::vector<Milestone> GetMilestones(void) const;
+
+private:
+    StartupTimeline(void);
+
+    mutable std::mutex     mMutex;
+    Timepoint              mStartTime;
+    std::vector<Milestone> mMilestones;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_TIMELINE_HPP_
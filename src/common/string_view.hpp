@@ -0,0 +1,195 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for a non-owning view of a string.
+ */
+
+#ifndef OTBR_COMMON_STRING_VIEW_HPP_
+#define OTBR_COMMON_STRING_VIEW_HPP_
+
+#include "openthread-br/config.h"
+
+#include <algorithm>
+#include <string>
+
+#include <stddef.h>
+#include <string.h>
+
+namespace otbr {
+
+/**
+ * This class implements a non-owning view of a sequence of characters.
+ *
+ * It follows the subset of the C++17 `std::string_view` interface which is used by OTBR, so that it could be replaced
+ * by `std::string_view` once OTBR requires C++17. A view must not outlive the string it refers to.
+ *
+ */
+class StringView
+{
+public:
+    static constexpr size_t npos = std::string::npos; ///< Indicates the end of the view or no match.
+
+    /**
+     * The constructor initializes an empty view.
+     *
+     */
+    constexpr StringView(void)
+        : mData(nullptr)
+        , mLength(0)
+    {
+    }
+
+    /**
+     * The constructor initializes a view of characters.
+     *
+     * @param[in] aData    A pointer to the characters.
+     * @param[in] aLength  The number of characters.
+     *
+     */
+    constexpr StringView(const char *aData, size_t aLength)
+        : mData(aData)
+        , mLength(aLength)
+    {
+    }
+
+    /**
+     * The constructor initializes a view of a null-terminated string.
+     *
+     * @param[in] aString  A pointer to the null-terminated string.
+     *
+     */
+    StringView(const char *aString)
+        : mData(aString)
+        , mLength(strlen(aString))
+    {
+    }
+
+    /**
+     * The constructor initializes a view of a string.
+     *
+     * @param[in] aString  A reference to the string.
+     *
+     */
+    StringView(const std::string &aString)
+        : mData(aString.data())
+        , mLength(aString.size())
+    {
+    }
+
+    const char *data(void) const { return mData; }
+    size_t      size(void) const { return mLength; }
+    bool        empty(void) const { return mLength == 0; }
+    const char *begin(void) const { return mData; }
+    const char *end(void) const { return mData + mLength; }
+    char        operator[](size_t aIndex) const { return mData[aIndex]; }
+
+    /**
+     * This method returns a view of a part of this view.
+     *
+     * @param[in] aPos     The position of the first character, which must not be larger than `size()`.
+     * @param[in] aLength  The maximum number of characters.
+     *
+     * @returns The view of the part.
+     *
+     */
+    StringView substr(size_t aPos, size_t aLength = npos) const
+    {
+        return StringView(mData + aPos, std::min(aLength, mLength - aPos));
+    }
+
+    /**
+     * This method finds the first occurrence of a character.
+     *
+     * @param[in] aChar  The character to find.
+     * @param[in] aPos   The position to start from.
+     *
+     * @returns The position of the character, or `npos` if not found.
+     *
+     */
+    size_t find(char aChar, size_t aPos = 0) const
+    {
+        size_t pos = npos;
+
+        for (size_t i = aPos; i < mLength; ++i)
+        {
+            if (mData[i] == aChar)
+            {
+                pos = i;
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    void remove_prefix(size_t aLength)
+    {
+        mData += aLength;
+        mLength -= aLength;
+    }
+
+    void remove_suffix(size_t aLength) { mLength -= aLength; }
+
+    /**
+     * This method indicates whether this view starts with another view.
+     *
+     * @param[in] aPrefix  The prefix.
+     *
+     * @returns Whether this view starts with @p aPrefix.
+     *
+     */
+    bool starts_with(StringView aPrefix) const
+    {
+        return mLength >= aPrefix.mLength && std::equal(aPrefix.begin(), aPrefix.end(), mData);
+    }
+
+    /**
+     * This method copies the characters of this view to a string.
+     *
+     * @returns The string.
+     *
+     */
+    std::string ToString(void) const { return std::string(mData, mLength); }
+
+    friend bool operator==(StringView aLhs, StringView aRhs)
+    {
+        return aLhs.mLength == aRhs.mLength && std::equal(aLhs.begin(), aLhs.end(), aRhs.begin());
+    }
+
+    friend bool operator!=(StringView aLhs, StringView aRhs) { return !(aLhs == aRhs); }
+
+private:
+    const char *mData;
+    size_t      mLength;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STRING_VIEW_HPP_
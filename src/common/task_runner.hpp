@@ -45,6 +45,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/move_only_function.hpp"
 #include "common/time.hpp"
 
 namespace otbr {
@@ -60,8 +61,10 @@ public:
     /**
      * This type represents the generic executable task.
      *
+     * Tasks are move-only, and small tasks are stored without heap allocation.
+     *
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = MoveOnlyFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
@@ -169,9 +172,11 @@ private:
 
         Timepoint GetTimeExecute(void) const { return mDeadline; }
 
-        TaskId     mTaskId;
-        Timepoint  mDeadline;
-        Task<void> mTask;
+        TaskId    mTaskId;
+        Timepoint mDeadline;
+
+        // Mutable so that the task can be moved out of `std::priority_queue::top()`.
+        mutable Task<void> mTask;
     };
 
     TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
@@ -27,7 +27,6 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -36,6 +35,170 @@
 
 namespace otbr {
 
+static const char kHexDigits[] = "0123456789abcdef";
+
+static char *WriteHex16(char *aOut, uint16_t aValue)
+{
+    // Writes the significant nibbles only.
+    int shift = (aValue >= 0x1000) ? 12 : (aValue >= 0x100) ? 8 : (aValue >= 0x10) ? 4 : 0;
+
+    for (; shift >= 0; shift -= 4)
+    {
+        *aOut++ = kHexDigits[(aValue >> shift) & 0xf];
+    }
+
+    return aOut;
+}
+
+static char *WriteDecimal8(char *aOut, uint8_t aValue)
+{
+    if (aValue >= 100)
+    {
+        *aOut++ = static_cast<char>('0' + aValue / 100);
+    }
+
+    if (aValue >= 10)
+    {
+        *aOut++ = static_cast<char>('0' + aValue / 10 % 10);
+    }
+
+    *aOut++ = static_cast<char>('0' + aValue % 10);
+
+    return aOut;
+}
+
+// Writes the address in the same form as `inet_ntop()`: the longest (and leftmost) run of at least two zero groups is
+// compressed, and the IPv4-compatible and IPv4-mapped addresses end with the IPv4 dotted form.
+static char *WriteIp6Address(const uint8_t *aBytes, char *aOut)
+{
+    uint16_t groups[8];
+    int      bestBase   = -1;
+    int      bestLength = 0;
+    int      curBase    = -1;
+
+    for (int i = 0; i < 8; i++)
+    {
+        groups[i] = static_cast<uint16_t>((aBytes[2 * i] << 8) | aBytes[2 * i + 1]);
+
+        if (groups[i] != 0)
+        {
+            curBase = -1;
+            continue;
+        }
+
+        if (curBase == -1)
+        {
+            curBase = i;
+        }
+
+        if (i + 1 - curBase > bestLength)
+        {
+            bestBase   = curBase;
+            bestLength = i + 1 - curBase;
+        }
+    }
+
+    if (bestLength < 2)
+    {
+        bestBase = -1;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (bestBase != -1 && i >= bestBase && i < bestBase + bestLength)
+        {
+            if (i == bestBase)
+            {
+                *aOut++ = ':';
+            }
+
+            continue;
+        }
+
+        if (i != 0)
+        {
+            *aOut++ = ':';
+        }
+
+        if (i == 6 && bestBase == 0 &&
+            (bestLength == 6 || (bestLength == 7 && groups[7] != 0x0001) || (bestLength == 5 && groups[5] == 0xffff)))
+        {
+            aOut    = WriteDecimal8(aOut, aBytes[12]);
+            *aOut++ = '.';
+            aOut    = WriteDecimal8(aOut, aBytes[13]);
+            *aOut++ = '.';
+            aOut    = WriteDecimal8(aOut, aBytes[14]);
+            *aOut++ = '.';
+            aOut    = WriteDecimal8(aOut, aBytes[15]);
+            break;
+        }
+
+        aOut = WriteHex16(aOut, groups[i]);
+    }
+
+    if (bestBase != -1 && bestBase + bestLength == 8)
+    {
+        *aOut++ = ':';
+    }
+
+    *aOut = '\0';
+
+    return aOut;
+}
+
+static int HexValue(char aChar)
+{
+    int value = -1;
+
+    if ('0' <= aChar && aChar <= '9')
+    {
+        value = aChar - '0';
+    }
+    else if ('a' <= aChar && aChar <= 'f')
+    {
+        value = aChar - 'a' + 10;
+    }
+    else if ('A' <= aChar && aChar <= 'F')
+    {
+        value = aChar - 'A' + 10;
+    }
+
+    return value;
+}
+
+// Parses an IPv4 address in the dotted form, which ends the string. Octets with leading zeros are rejected as
+// `inet_pton()` does.
+static bool ParseIp4Address(const char *aStr, uint8_t *aBytes)
+{
+    bool parsed = false;
+
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned value  = 0;
+        int      digits = 0;
+
+        if (i != 0)
+        {
+            VerifyOrExit(*aStr++ == '.');
+        }
+
+        for (; '0' <= *aStr && *aStr <= '9'; aStr++, digits++)
+        {
+            VerifyOrExit(digits == 0 || value != 0);
+            value = value * 10 + static_cast<unsigned>(*aStr - '0');
+            VerifyOrExit(value <= 255);
+        }
+
+        VerifyOrExit(digits > 0);
+        aBytes[i] = static_cast<uint8_t>(value);
+    }
+
+    parsed = (*aStr == '\0');
+
+exit:
+    return parsed;
+}
+
 Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 {
     memcpy(m8, aAddress, sizeof(m8));
@@ -43,12 +206,16 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+    return std::string(ToString(strbuf));
+}
 
-    return std::string(strbuf);
+const char *Ip6Address::ToString(char (&aBuffer)[kStringSize]) const
+{
+    WriteIp6Address(m8, aBuffer);
+
+    return aBuffer;
 }
 
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
@@ -88,11 +255,81 @@ void Ip6Address::CopyFrom(const struct in6_addr &aIn6Addr)
 
 otbrError Ip6Address::FromString(const char *aStr, Ip6Address &aAddr)
 {
-    int ret;
+    otbrError   error     = OTBR_ERROR_INVALID_ARGS;
+    uint8_t     bytes[16] = {0};
+    size_t      length    = 0;
+    bool        hasGap    = false;
+    size_t      gapIndex  = 0; // The index of "::".
+    const char *str       = aStr;
+
+    // A leading colon must be a part of "::", which is handled with the next group.
+    if (*str == ':')
+    {
+        VerifyOrExit(*++str == ':');
+    }
+
+    while (true)
+    {
+        const char *groupStart;
+        uint32_t    group = 0;
+        int         digit;
+
+        if (*str == ':')
+        {
+            VerifyOrExit(!hasGap);
+            hasGap   = true;
+            gapIndex = length;
+
+            if (*++str == '\0')
+            {
+                break;
+            }
+        }
+
+        for (groupStart = str; (digit = HexValue(*str)) >= 0; str++)
+        {
+            VerifyOrExit(str - groupStart < 4);
+            group = (group << 4) | static_cast<uint32_t>(digit);
+        }
 
-    ret = inet_pton(AF_INET6, aStr, &aAddr.m8);
+        if (*str == '.')
+        {
+            // The trailing IPv4 address.
+            VerifyOrExit(length + 4 <= sizeof(bytes) && ParseIp4Address(groupStart, &bytes[length]));
+            length += 4;
+            break;
+        }
 
-    return ret == 1 ? OTBR_ERROR_NONE : OTBR_ERROR_INVALID_ARGS;
+        VerifyOrExit(str != groupStart && length + 2 <= sizeof(bytes));
+        bytes[length++] = static_cast<uint8_t>(group >> 8);
+        bytes[length++] = static_cast<uint8_t>(group);
+
+        if (*str == '\0')
+        {
+            break;
+        }
+
+        // A trailing colon must be a part of "::".
+        VerifyOrExit(*str++ == ':' && *str != '\0');
+    }
+
+    if (hasGap)
+    {
+        // "::" stands for at least one group of zeros.
+        VerifyOrExit(length < sizeof(bytes));
+        memmove(&bytes[sizeof(bytes) - (length - gapIndex)], &bytes[gapIndex], length - gapIndex);
+        memset(&bytes[gapIndex], 0, sizeof(bytes) - length);
+    }
+    else
+    {
+        VerifyOrExit(length == sizeof(bytes));
+    }
+
+    memcpy(aAddr.m8, bytes, sizeof(bytes));
+    error = OTBR_ERROR_NONE;
+
+exit:
+    return error;
 }
 
 Ip6Address Ip6Address::FromString(const char *aStr)
@@ -111,19 +348,20 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+    return std::string(ToString(strbuf));
+}
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+const char *Ip6Prefix::ToString(char (&aBuffer)[kStringSize]) const
+{
+    char *cur = WriteIp6Address(mPrefix.m8, aBuffer);
 
-    snprintf(strbuf, sizeof(strbuf), "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+    *cur++ = '/';
+    cur    = WriteDecimal8(cur, mLength);
+    *cur   = '\0';
 
-    return strBuilder.str();
+    return aBuffer;
 }
 
 std::string MacAddress::ToString(void) const
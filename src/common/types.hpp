@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
@@ -108,6 +109,11 @@ static constexpr char kLinkLocalAllNodesMulticastAddress[] = "ff02::01";
 class Ip6Address
 {
 public:
+    enum
+    {
+        kStringSize = INET6_ADDRSTRLEN, ///< The size of a buffer for the string representation, including the null.
+    };
+
     /**
      * Default constructor.
      *
@@ -185,6 +191,18 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 address into a buffer without allocating memory.
+     *
+     * The Ip6 address is formatted in the RFC 5952 compressed form, the same as `inet_ntop()` does.
+     *
+     * @param[out] aBuffer  The buffer to write the string representation into.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -308,6 +326,11 @@ private:
 class Ip6Prefix
 {
 public:
+    enum
+    {
+        kStringSize = Ip6Address::kStringSize + 4, ///< The size of a buffer for the string representation.
+    };
+
     /**
      * Default constructor.
      *
@@ -330,6 +353,16 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation for the Ip6 prefix into a buffer without allocating memory.
+     *
+     * @param[out] aBuffer  The buffer to write the string representation into.
+     *
+     * @returns A pointer to @p aBuffer.
+     *
+     */
+    const char *ToString(char (&aBuffer)[kStringSize]) const;
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      *
@@ -414,4 +447,27 @@ struct MdnsTelemetryInfo
 
 } // namespace otbr
 
+namespace std {
+
+/**
+ * This structure implements the hash of `Ip6Address`, so that it can be the key of unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6Address>
+{
+    size_t operator()(const otbr::Ip6Address &aAddress) const
+    {
+        // Mixes both halves with the MurmurHash3 finalizer, since addresses often differ only in a few bits.
+        uint64_t hash = aAddress.m64[0] * 0x9e3779b97f4a7c15ull ^ aAddress.m64[1];
+
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+
+        return static_cast<size_t>(hash);
+    }
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
@@ -0,0 +1,99 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the Worker Pool that executes tasks off the mainloop.
+ */
+
+#include "common/worker_pool.hpp"
+
+namespace otbr {
+
+WorkerPool::WorkerPool(size_t aNumWorkers)
+    : mNumWorkers(aNumWorkers > 0 ? aNumWorkers : 1)
+    , mStopping(false)
+{
+}
+
+WorkerPool::~WorkerPool(void)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondition.notify_all();
+
+    for (std::thread &worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::Post(TaskRunner::Task<void> aTask)
+{
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+
+        mTasks.push(std::move(aTask));
+
+        while (mWorkers.size() < mNumWorkers)
+        {
+            mWorkers.emplace_back(&WorkerPool::Run, this);
+        }
+    }
+
+    mCondition.notify_one();
+}
+
+void WorkerPool::Run(void)
+{
+    while (true)
+    {
+        TaskRunner::Task<void> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            mCondition.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+            VerifyOrExit(!mStopping);
+
+            task = std::move(mTasks.front());
+            mTasks.pop();
+        }
+
+        task();
+    }
+
+exit:
+    return;
+}
+
+} // namespace otbr
@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the Worker Pool that executes tasks off the mainloop.
+ */
+
+#ifndef OTBR_COMMON_WORKER_POOL_HPP_
+#define OTBR_COMMON_WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the Worker Pool that executes tasks on worker threads.
+ *
+ * The mainloop thread drives OpenThread and the spinel link, so the expensive work which does not
+ * need the OpenThread state, e.g. serializing a snapshot of the state, is offloaded to the workers.
+ * A task must not call any OpenThread API nor access any state owned by the mainloop, and reports
+ * its result by posting a task to a `TaskRunner`.
+ *
+ * The worker threads are started on the first posted task.
+ *
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the Worker Pool instance.
+     *
+     * @param[in] aNumWorkers  The number of the worker threads.
+     *
+     */
+    explicit WorkerPool(size_t aNumWorkers = 1);
+
+    /**
+     * This destructor destroys the Worker Pool instance.
+     *
+     * The running tasks are waited for, and the tasks which have not started are dropped.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts a task to the worker pool and returns immediately.
+     *
+     * Tasks are started in the order they are posted, and may run concurrently if there
+     * are more than one worker threads. It is safe to call this method in different threads
+     * concurrently.
+     *
+     * @param[in] aTask  The task to be executed.
+     *
+     */
+    void Post(TaskRunner::Task<void> aTask);
+
+private:
+    void Run(void);
+
+    const size_t                       mNumWorkers;
+    std::mutex                         mMutex;
+    std::condition_variable            mCondition;
+    std::queue<TaskRunner::Task<void>> mTasks;
+    std::vector<std::thread>           mWorkers;
+    bool                               mStopping;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_WORKER_POOL_HPP_
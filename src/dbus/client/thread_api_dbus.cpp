@@ -126,9 +126,8 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
     OTBR_UNUSED_VARIABLE(aConnection);
 
-    DBusMessageIter iter, subIter, dictEntryIter, valIter;
-    std::string     interfaceName, propertyName, val;
-    DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
+    DBusMessageIter iter, subIter;
+    std::string     interfaceName;
 
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
@@ -137,21 +136,33 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
 
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
-
-    for (const auto &f : mDeviceRoleHandlers)
+    // The server coalesces changed properties, so the device role may be any entry of the dictionary.
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
     {
-        f(role);
+        DBusMessageIter dictEntryIter, valIter;
+        std::string     propertyName, val;
+        DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
+
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+
+        if (propertyName != OTBR_DBUS_PROPERTY_DEVICE_ROLE)
+        {
+            continue;
+        }
+
+        VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
+        dbus_message_iter_recurse(&dictEntryIter, &valIter);
+        SuccessOrExit(DBusMessageExtract(&valIter, val));
+        SuccessOrExit(NameToDeviceRole(val, role));
+
+        for (const auto &f : mDeviceRoleHandlers)
+        {
+            f(role);
+        }
+        handled = DBUS_HANDLER_RESULT_HANDLED;
     }
-    handled = DBUS_HANDLER_RESULT_HANDLED;
 
 exit:
     return handled;
@@ -608,6 +619,11 @@ ClientError ThreadApiDBus::GetNeighborTable(std::vector<NeighborInfo> &aNeighbor
     return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY, aNeighborTable);
 }
 
+ClientError ThreadApiDBus::GetTopology(std::vector<TopologyNode> &aTopology)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_TOPOLOGY, aTopology);
+}
+
 ClientError ThreadApiDBus::GetPartitionId(uint32_t &aPartitionId)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, aPartitionId);
@@ -678,6 +694,11 @@ ClientError ThreadApiDBus::GetNat64ErrorCounters(Nat64ErrorCounters &aCounters)
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS, aCounters);
 }
 
+ClientError ThreadApiDBus::GetStartupTimeline(std::vector<StartupMilestone> &aTimeline)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_STARTUP_TIMELINE, aTimeline);
+}
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 ClientError ThreadApiDBus::GetDnssdCounters(DnssdCounters &aDnssdCounters)
 {
@@ -836,6 +857,137 @@ exit:
     return ret;
 }
 
+UniqueDBusMessage ThreadApiDBus::NewMethodCall(const char *aInterfaceName, const char *aMethodName)
+{
+    return UniqueDBusMessage(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                          (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                          aInterfaceName, aMethodName));
+}
+
+ClientError ThreadApiDBus::SendWithReplyAsync(DBusMessage &aMessage, ReplyHandler aHandler)
+{
+    ClientError      ret          = ClientError::ERROR_NONE;
+    DBusPendingCall *pending      = nullptr;
+    ReplyHandler    *replyHandler = nullptr;
+
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, &aMessage, &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+
+    // The handler is owned by the pending call and freed with it, so that the reply may arrive
+    // after the caller's scope is gone.
+    replyHandler = new ReplyHandler(std::move(aHandler));
+    if (!dbus_pending_call_set_notify(pending, &ThreadApiDBus::HandleReply, replyHandler,
+                                      &ThreadApiDBus::FreeReplyHandler))
+    {
+        delete replyHandler;
+        dbus_pending_call_cancel(pending);
+        ExitNow(ret = ClientError::ERROR_DBUS);
+    }
+
+exit:
+    if (pending != nullptr)
+    {
+        dbus_pending_call_unref(pending);
+    }
+    return ret;
+}
+
+void ThreadApiDBus::HandleReply(DBusPendingCall *aPending, void *aReplyHandler)
+{
+    UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+
+    (*static_cast<ReplyHandler *>(aReplyHandler))(reply.get());
+}
+
+void ThreadApiDBus::FreeReplyHandler(void *aReplyHandler)
+{
+    delete static_cast<ReplyHandler *>(aReplyHandler);
+}
+
+ClientError ThreadApiDBus::GetDeviceRoleAsync(const PropertyHandler<DeviceRole> &aHandler)
+{
+    return GetPropertyAsync<std::string>(OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+                                         [aHandler](ClientError aError, const std::string &aRoleName) {
+                                             DeviceRole role = OTBR_DEVICE_ROLE_DISABLED;
+
+                                             if (aError == ClientError::ERROR_NONE)
+                                             {
+                                                 aError = NameToDeviceRole(aRoleName, role);
+                                             }
+                                             aHandler(aError, role);
+                                         });
+}
+
+ClientError ThreadApiDBus::GetProperties(const std::vector<std::string> &aPropertyNames, PropertyValues &aValues)
+{
+    UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD);
+    UniqueDBusMessage reply;
+    ClientError       ret = ClientError::ERROR_NONE;
+    DBusError         error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    ret = aValues.Init(std::move(reply));
+
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::GetPropertiesAsync(const std::vector<std::string> &aPropertyNames,
+                                              const PropertyValuesHandler    &aHandler)
+{
+    UniqueDBusMessage message = NewMethodCall(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD);
+    ClientError       ret     = ClientError::ERROR_NONE;
+
+    VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+
+    ret = SendWithReplyAsync(*message, [aHandler](DBusMessage *aReply) {
+        PropertyValues values;
+        ClientError    error = ClientError::ERROR_DBUS;
+
+        if (aReply != nullptr)
+        {
+            error = values.Init(UniqueDBusMessage(dbus_message_ref(aReply)));
+        }
+        aHandler(error, values);
+    });
+
+exit:
+    return ret;
+}
+
+ClientError PropertyValues::Init(UniqueDBusMessage aReply)
+{
+    ClientError     error = ClientError::ERROR_NONE;
+    DBusMessageIter iter, subIter;
+
+    mValueIters.clear();
+    mReply = std::move(aReply);
+
+    SuccessOrExit(error = CheckErrorMessage(mReply.get()));
+    VerifyOrExit(dbus_message_iter_init(mReply.get(), &iter), error = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, error = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_VARIANT; dbus_message_iter_next(&subIter))
+    {
+        mValueIters.push_back(subIter);
+    }
+
+exit:
+    return error;
+}
+
 template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
 void ThreadApiDBus::sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus)
 {
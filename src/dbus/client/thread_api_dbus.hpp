@@ -38,8 +38,12 @@
 
 #include <dbus/dbus.h>
 
+#include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "dbus/client/client_error.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -48,6 +52,54 @@ namespace DBus {
 
 bool IsThreadActive(DeviceRole aRole);
 
+/**
+ * This class holds the property values replied to a `GetProperties` call.
+ *
+ */
+class PropertyValues
+{
+public:
+    /**
+     * This method returns the number of the property values.
+     *
+     * @returns The number of the property values.
+     *
+     */
+    size_t GetSize(void) const { return mValueIters.size(); }
+
+    /**
+     * This method decodes a property value.
+     *
+     * @param[in]  aIndex  The index of the property in the requested property names.
+     * @param[out] aValue  The property value.
+     *
+     * @retval ERROR_NONE             Successfully decoded the property value.
+     * @retval OT_ERROR_INVALID_ARGS  @p aIndex is out of range.
+     * @retval ERROR_DBUS             The property value is not of the type @p ValType.
+     *
+     */
+    template <typename ValType> ClientError Get(size_t aIndex, ValType &aValue) const
+    {
+        ClientError     error = ClientError::ERROR_NONE;
+        DBusMessageIter iter;
+
+        VerifyOrExit(aIndex < mValueIters.size(), error = ClientError::OT_ERROR_INVALID_ARGS);
+        iter = mValueIters[aIndex];
+        VerifyOrExit(DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+
+    exit:
+        return error;
+    }
+
+private:
+    friend class ThreadApiDBus;
+
+    ClientError Init(UniqueDBusMessage aReply);
+
+    UniqueDBusMessage            mReply;
+    std::vector<DBusMessageIter> mValueIters;
+};
+
 class ThreadApiDBus
 {
 public:
@@ -56,6 +108,9 @@ public:
     using EnergyScanHandler = std::function<void(const std::vector<EnergyScanResult> &)>;
     using OtResultHandler   = std::function<void(ClientError)>;
 
+    template <typename ValType> using PropertyHandler = std::function<void(ClientError, const ValType &)>;
+    using PropertyValuesHandler                       = std::function<void(ClientError, const PropertyValues &)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -646,6 +701,20 @@ public:
      */
     ClientError GetNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
 
+    /**
+     * This method gets the network topology.
+     *
+     * The topology is read from the model maintained by the agent, so it does not trigger any mesh traffic.
+     *
+     * @param[out] aTopology  The nodes of the network topology.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetTopology(std::vector<TopologyNode> &aTopology);
+
     /**
      * This method gets the network's parition id.
      *
@@ -856,7 +925,90 @@ public:
      */
     ClientError GetNat64ErrorCounters(Nat64ErrorCounters &aCounters);
 
+    /**
+     * This method gets the startup timeline of the agent.
+     *
+     * @param[out] aTimeline  The startup milestones, in the order they are reached.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetStartupTimeline(std::vector<StartupMilestone> &aTimeline);
+
+    /**
+     * This method gets a property without blocking.
+     *
+     * The handler is invoked from `dbus_connection_dispatch()` when the reply arrives, so multiple
+     * properties can be requested before waiting for any of the replies.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aHandler       The handler of the property value.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error.
+     *
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler);
+
+    /**
+     * This method sets a property without blocking.
+     *
+     * @param[in] aPropertyName  The property name.
+     * @param[in] aValue         The property value.
+     * @param[in] aHandler       The handler of the result, can be nullptr.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error.
+     *
+     */
+    template <typename ValType>
+    ClientError SetPropertyAsync(const std::string     &aPropertyName,
+                                 const ValType         &aValue,
+                                 const OtResultHandler &aHandler);
+
+    /**
+     * This method gets the device role without blocking.
+     *
+     * @param[in] aHandler  The handler of the device role.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error.
+     *
+     */
+    ClientError GetDeviceRoleAsync(const PropertyHandler<DeviceRole> &aHandler);
+
+    /**
+     * This method gets multiple properties in one call.
+     *
+     * @param[in]  aPropertyNames  The property names.
+     * @param[out] aValues         The property values, in the order of @p aPropertyNames.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, PropertyValues &aValues);
+
+    /**
+     * This method gets multiple properties in one call without blocking.
+     *
+     * @param[in] aPropertyNames  The property names.
+     * @param[in] aHandler        The handler of the property values, in the order of @p aPropertyNames.
+     *
+     * @retval ERROR_NONE  Successfully sent the request.
+     * @retval ERROR_DBUS  dbus encode/send error.
+     *
+     */
+    ClientError GetPropertiesAsync(const std::vector<std::string> &aPropertyNames,
+                                   const PropertyValuesHandler    &aHandler);
+
 private:
+    using ReplyHandler = std::function<void(DBusMessage *aReply)>;
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -871,6 +1023,13 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    UniqueDBusMessage NewMethodCall(const char *aInterfaceName, const char *aMethodName);
+    ClientError       SendWithReplyAsync(DBusMessage &aMessage, ReplyHandler aHandler);
+    static void       HandleReply(DBusPendingCall *aPending, void *aReplyHandler);
+    static void       FreeReplyHandler(void *aReplyHandler);
+
+    template <typename ValType> static ClientError ExtractPropertyReply(DBusMessage *aReply, ValType &aValue);
+
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
@@ -904,6 +1063,69 @@ private:
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
 };
 
+template <typename ValType>
+ClientError ThreadApiDBus::GetPropertyAsync(const std::string &aPropertyName, const PropertyHandler<ValType> &aHandler)
+{
+    ClientError       error   = ClientError::ERROR_NONE;
+    UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD);
+
+    VerifyOrExit(message != nullptr, error = ClientError::OT_ERROR_FAILED);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) == OTBR_ERROR_NONE,
+                 error = ClientError::ERROR_DBUS);
+
+    error = SendWithReplyAsync(*message, [aHandler](DBusMessage *aReply) {
+        ValType     value{};
+        ClientError ret = ExtractPropertyReply(aReply, value);
+
+        aHandler(ret, value);
+    });
+
+exit:
+    return error;
+}
+
+template <typename ValType>
+ClientError ThreadApiDBus::SetPropertyAsync(const std::string     &aPropertyName,
+                                            const ValType         &aValue,
+                                            const OtResultHandler &aHandler)
+{
+    ClientError       error   = ClientError::ERROR_NONE;
+    UniqueDBusMessage message = NewMethodCall(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_SET_METHOD);
+    DBusMessageIter   iter;
+
+    VerifyOrExit(message != nullptr, error = ClientError::OT_ERROR_FAILED);
+
+    dbus_message_iter_init_append(message.get(), &iter);
+    VerifyOrExit(DBusMessageEncode(&iter, OTBR_DBUS_THREAD_INTERFACE) == OTBR_ERROR_NONE,
+                 error = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBusMessageEncode(&iter, aPropertyName) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBusMessageEncodeToVariant(&iter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+
+    error = SendWithReplyAsync(*message, [aHandler](DBusMessage *aReply) {
+        if (aHandler)
+        {
+            aHandler(aReply != nullptr ? CheckErrorMessage(aReply) : ClientError::ERROR_DBUS);
+        }
+    });
+
+exit:
+    return error;
+}
+
+template <typename ValType> ClientError ThreadApiDBus::ExtractPropertyReply(DBusMessage *aReply, ValType &aValue)
+{
+    ClientError     error = ClientError::ERROR_DBUS;
+    DBusMessageIter iter;
+
+    VerifyOrExit(aReply != nullptr);
+    SuccessOrExit(error = CheckErrorMessage(aReply));
+    VerifyOrExit(dbus_message_iter_init(aReply, &iter), error = ClientError::ERROR_DBUS);
+    VerifyOrExit(DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE, error = ClientError::ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
 
@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the d-bus member dispatch table.
+ */
+
+#ifndef OTBR_DBUS_COMMON_DBUS_DISPATCH_TABLE_HPP_
+#define OTBR_DBUS_COMMON_DBUS_DISPATCH_TABLE_HPP_
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class implements a table which maps a (interface, member) name pair to a handler.
+ *
+ * The hash of the names is computed once when a handler is added, so looking up a handler
+ * with the raw names from a d-bus message does not allocate memory.
+ *
+ */
+template <typename HandlerType> class DBusDispatchTable
+{
+public:
+    /**
+     * This method adds a handler to the table.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aMemberName     The member (method or property) name.
+     * @param[in] aHandler        The handler.
+     *
+     * @retval TRUE   Successfully added the handler.
+     * @retval FALSE  A handler with the same names already exists.
+     *
+     */
+    bool Add(const std::string &aInterfaceName, const std::string &aMemberName, HandlerType aHandler)
+    {
+        bool     added = false;
+        uint32_t hash  = Hash(aInterfaceName.c_str(), aMemberName.c_str());
+        auto     iter  = std::lower_bound(mEntries.begin(), mEntries.end(), hash, CompareHash);
+
+        if (Find(aInterfaceName.c_str(), aMemberName.c_str()) == nullptr)
+        {
+            mEntries.insert(iter, Entry{hash, aInterfaceName, aMemberName, std::move(aHandler)});
+            added = true;
+        }
+
+        return added;
+    }
+
+    /**
+     * This method finds the handler of an (interface, member) name pair.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aMemberName     The member name.
+     *
+     * @returns A pointer to the handler, or nullptr if not found.
+     *
+     */
+    const HandlerType *Find(const char *aInterfaceName, const char *aMemberName) const
+    {
+        const HandlerType *handler = nullptr;
+
+        if (aInterfaceName != nullptr && aMemberName != nullptr)
+        {
+            uint32_t hash = Hash(aInterfaceName, aMemberName);
+
+            for (auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), hash, CompareHash);
+                 iter != mEntries.end() && iter->mHash == hash; ++iter)
+            {
+                if (iter->mMemberName == aMemberName && iter->mInterfaceName == aInterfaceName)
+                {
+                    handler = &iter->mHandler;
+                    break;
+                }
+            }
+        }
+
+        return handler;
+    }
+
+    /**
+     * This method returns whether the table has any handler of the interface.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     *
+     * @returns Whether the table has any handler of @p aInterfaceName.
+     *
+     */
+    bool HasInterface(const char *aInterfaceName) const
+    {
+        bool found = false;
+
+        for (const Entry &entry : mEntries)
+        {
+            if (entry.mInterfaceName == aInterfaceName)
+            {
+                found = true;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * This method invokes @p aVisitor with the member name and handler of each entry of an interface.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aVisitor        The visitor which returns `false` to stop the iteration.
+     *
+     */
+    template <typename VisitorType> void ForEach(const char *aInterfaceName, VisitorType aVisitor) const
+    {
+        for (const Entry &entry : mEntries)
+        {
+            if (entry.mInterfaceName == aInterfaceName && !aVisitor(entry.mMemberName, entry.mHandler))
+            {
+                break;
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        uint32_t    mHash;
+        std::string mInterfaceName;
+        std::string mMemberName;
+        HandlerType mHandler;
+    };
+
+    static bool CompareHash(const Entry &aEntry, uint32_t aHash) { return aEntry.mHash < aHash; }
+
+    // FNV-1a over "<interface>.<member>".
+    static uint32_t Hash(const char *aInterfaceName, const char *aMemberName)
+    {
+        constexpr uint32_t kFnvPrime = 16777619u;
+        uint32_t           hash      = 2166136261u;
+
+        for (const char *c = aInterfaceName; *c != '\0'; ++c)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * kFnvPrime;
+        }
+
+        hash = (hash ^ static_cast<uint8_t>('.')) * kFnvPrime;
+
+        for (const char *c = aMemberName; *c != '\0'; ++c)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * kFnvPrime;
+        }
+
+        return hash;
+    }
+
+    std::vector<Entry> mEntries;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_COMMON_DBUS_DISPATCH_TABLE_HPP_
@@ -31,6 +31,63 @@
 namespace otbr {
 namespace DBus {
 
+static otbrError DBusMessageCopy(DBusMessageIter *aSrcIter, DBusMessageIter *aDestIter, uint8_t aDepth)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       type  = dbus_message_iter_get_arg_type(aSrcIter);
+
+    VerifyOrExit(type != DBUS_TYPE_INVALID, error = OTBR_ERROR_DBUS);
+    VerifyOrExit(aDepth <= DBUS_MAXIMUM_TYPE_RECURSION_DEPTH, error = OTBR_ERROR_DBUS);
+
+    if (dbus_type_is_basic(type))
+    {
+        DBusBasicValue value;
+
+        dbus_message_iter_get_basic(aSrcIter, &value);
+        VerifyOrExit(dbus_message_iter_append_basic(aDestIter, type, &value), error = OTBR_ERROR_DBUS);
+    }
+    else
+    {
+        DBusMessageIter srcSubIter;
+        DBusMessageIter destSubIter;
+        char           *signature = nullptr;
+
+        dbus_message_iter_recurse(aSrcIter, &srcSubIter);
+
+        // Only arrays and variants require the signature of the contained type.
+        if (type == DBUS_TYPE_ARRAY || type == DBUS_TYPE_VARIANT)
+        {
+            signature = dbus_message_iter_get_signature(&srcSubIter);
+            VerifyOrExit(signature != nullptr, error = OTBR_ERROR_DBUS);
+        }
+
+        if (!dbus_message_iter_open_container(aDestIter, type, signature, &destSubIter))
+        {
+            error = OTBR_ERROR_DBUS;
+        }
+
+        dbus_free(signature);
+        SuccessOrExit(error);
+
+        while (dbus_message_iter_get_arg_type(&srcSubIter) != DBUS_TYPE_INVALID)
+        {
+            SuccessOrExit(error = DBusMessageCopy(&srcSubIter, &destSubIter, aDepth + 1));
+        }
+
+        VerifyOrExit(dbus_message_iter_close_container(aDestIter, &destSubIter), error = OTBR_ERROR_DBUS);
+    }
+
+    dbus_message_iter_next(aSrcIter);
+
+exit:
+    return error;
+}
+
+otbrError DBusMessageCopy(DBusMessageIter *aSrcIter, DBusMessageIter *aDestIter)
+{
+    return DBusMessageCopy(aSrcIter, aDestIter, 0);
+}
+
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue)
 {
     otbrError   error = OTBR_ERROR_DBUS;
@@ -71,6 +128,19 @@ exit:
     return error;
 }
 
+otbrError DBusMessageExtract(DBusMessageIter *aIter, const char *&aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // The string is owned by the message and is valid until the message is freed.
+    VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_STRING, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_get_basic(aIter, &aValue);
+    dbus_message_iter_next(aIter);
+
+exit:
+    return error;
+}
+
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue)
 {
     return DBusMessageExtractPrimitive(aIter, aValue);
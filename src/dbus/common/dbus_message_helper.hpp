@@ -71,6 +71,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChildInfo &aChildInfo)
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChildInfo &aChildInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const NeighborInfo &aNeighborInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, NeighborInfo &aNeighborInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TopologyRoute &aRoute);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TopologyRoute &aRoute);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TopologyChild &aChild);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TopologyChild &aChild);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const TopologyNode &aNode);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, TopologyNode &aNode);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderData);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
@@ -113,6 +119,8 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const Nat64ErrorCounters &aC
 otbrError DBusMessageExtract(DBusMessageIter *aIter, Nat64ErrorCounters &aCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const InfraLinkInfo &aInfraLinkInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, InfraLinkInfo &aInfraLinkInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const StartupMilestone &aMilestone);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, StartupMilestone &aMilestone);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -209,6 +217,34 @@ template <> struct DBusTypeTrait<ChildInfo>
     static constexpr const char *TYPE_AS_STRING = "(tuuqqyyyyqqbbbb)";
 };
 
+template <> struct DBusTypeTrait<TopologyRoute>
+{
+    // struct of { uint16, uint8, uint8, uint8 }
+    static constexpr const char *TYPE_AS_STRING = "(qyyy)";
+};
+
+template <> struct DBusTypeTrait<TopologyChild>
+{
+    // struct of { uint16, uint32, struct of { bool, bool, bool } }
+    static constexpr const char *TYPE_AS_STRING = "(qu(bbb))";
+};
+
+template <> struct DBusTypeTrait<TopologyNode>
+{
+    // struct of { uint16, uint64, struct of { bool, bool, bool }, uint32,
+    //             array of struct of { uint16, uint8, uint8, uint8 },
+    //             array of struct of { uint16, uint32, struct of { bool, bool, bool } } }
+    static constexpr const char *TYPE_AS_STRING = "(qt(bbb)ua(qyyy)a(qu(bbb)))";
+};
+
+template <> struct DBusTypeTrait<std::vector<TopologyNode>>
+{
+    // array of struct of { uint16, uint64, struct of { bool, bool, bool }, uint32,
+    //                      array of struct of { uint16, uint8, uint8, uint8 },
+    //                      array of struct of { uint16, uint32, struct of { bool, bool, bool } } }
+    static constexpr const char *TYPE_AS_STRING = "a(qt(bbb)ua(qyyy)a(qu(bbb)))";
+};
+
 template <> struct DBusTypeTrait<ActiveScanResult>
 {
     // struct of { uint64, string, uint64, array<uint8>, uint16, uint16, uint8,
@@ -386,6 +422,18 @@ template <> struct DBusTypeTrait<InfraLinkInfo>
     static constexpr const char *TYPE_AS_STRING = "(sbbbuuu)";
 };
 
+template <> struct DBusTypeTrait<StartupMilestone>
+{
+    // struct of { string, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(st)";
+};
+
+template <> struct DBusTypeTrait<std::vector<StartupMilestone>>
+{
+    // array of struct of { string, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "a(st)";
+};
+
 template <> struct DBusTypeTrait<int8_t>
 {
     static constexpr int         TYPE           = DBUS_TYPE_BYTE;
@@ -454,6 +502,7 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, int8_t &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::string &aValue);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, const char *&aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue);
@@ -462,6 +511,20 @@ otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValu
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue);
 
+/**
+ * This function copies the current value of @p aSrcIter, including nested containers, to @p aDestIter.
+ *
+ * On success, @p aSrcIter is advanced to the next value.
+ *
+ * @param[in,out] aSrcIter   The iterator to read the value from.
+ * @param[in,out] aDestIter  The iterator to append the value to.
+ *
+ * @retval OTBR_ERROR_NONE  Successfully copied the value.
+ * @retval OTBR_ERROR_DBUS  Failed to copy the value.
+ *
+ */
+otbrError DBusMessageCopy(DBusMessageIter *aSrcIter, DBusMessageIter *aDestIter);
+
 template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, T &aValue)
 {
     otbrError error = OTBR_ERROR_DBUS;
@@ -507,6 +507,31 @@ struct NeighborInfo
     bool     mIsChild;          ///< Is the neighbor a child
 };
 
+struct TopologyRoute
+{
+    uint16_t mRouterRloc16;   ///< The RLOC16 of the destination router
+    uint8_t  mLinkQualityIn;  ///< Link Quality In, 0 if there is no direct link
+    uint8_t  mLinkQualityOut; ///< Link Quality Out, 0 if there is no direct link
+    uint8_t  mRouteCost;      ///< Route Cost
+};
+
+struct TopologyChild
+{
+    uint16_t       mRloc16;  ///< RLOC16
+    uint32_t       mTimeout; ///< Timeout in seconds
+    LinkModeConfig mMode;    ///< Link Mode
+};
+
+struct TopologyNode
+{
+    uint16_t                   mRloc16;     ///< RLOC16
+    uint64_t                   mExtAddress; ///< IEEE 802.15.4 Extended Address
+    LinkModeConfig             mMode;       ///< Link Mode
+    uint32_t                   mAge;        ///< Seconds since the node is updated
+    std::vector<TopologyRoute> mRoutes;     ///< Routes to the other routers
+    std::vector<TopologyChild> mChildren;   ///< Children of the node
+};
+
 struct LeaderData
 {
     uint32_t mPartitionId;       ///< Partition ID
@@ -701,6 +726,12 @@ struct InfraLinkInfo
     uint32_t    mGlobalUnicastAddresses; ///< The number of global unicast addresses on the infra network interface.
 };
 
+struct StartupMilestone
+{
+    std::string mName;    ///< The name of the milestone.
+    uint64_t    mElapsed; ///< Milliseconds from the start of the agent to the milestone.
+};
+
 } // namespace DBus
 } // namespace otbr
 
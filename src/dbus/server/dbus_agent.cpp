@@ -35,6 +35,7 @@
 #include <unistd.h>
 
 #include "common/logging.hpp"
+#include "common/startup_timeline.hpp"
 #include "dbus/common/constants.hpp"
 #include "mdns/mdns.hpp"
 
@@ -51,24 +52,42 @@ DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPu
 {
 }
 
+void DBusAgent::Connect(void)
+{
+    // The connection and the watches are only accessed by the background thread until `Init()` takes them.
+    mConnectionFuture = std::async(std::launch::async, [this]() { return WaitForDBusConnection(); });
+}
+
 void DBusAgent::Init(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    auto connection_deadline = Clock::now() + kDBusWaitAllowance;
+    mConnection = mConnectionFuture.valid() ? mConnectionFuture.get() : WaitForDBusConnection();
+    VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
+
+    mThreadObject =
+        std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher));
+    error = mThreadObject->Init();
+    VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
+}
 
-    while ((mConnection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
+DBusAgent::UniqueDBusConnection DBusAgent::WaitForDBusConnection(void)
+{
+    UniqueDBusConnection connection;
+    auto                 connection_deadline = Clock::now() + kDBusWaitAllowance;
+
+    while ((connection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
     {
         otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
 
-    VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
+    if (connection != nullptr)
+    {
+        StartupTimeline::GetInstance().Record("dbus-connected");
+    }
 
-    mThreadObject =
-        std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher));
-    error = mThreadObject->Init();
-    VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
+    return connection;
 }
 
 DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
@@ -197,8 +216,10 @@ void DBusAgent::Process(const MainloopContext &aMainloop)
         dbus_watch_handle(watch, flags);
     }
 
-    while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
-        ;
+    // `Update()` sets a zero timeout while messages remain to be dispatched.
+    ProcessWithinBudget(kMaxDispatchesPerProcess, [this]() {
+        return dbus_connection_dispatch(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS;
+    });
 }
 
 } // namespace DBus
@@ -35,6 +35,7 @@
 #define OTBR_DBUS_AGENT_HPP_
 
 #include <functional>
+#include <future>
 #include <set>
 #include <string>
 #include <sys/select.h>
@@ -62,30 +63,45 @@ public:
      */
     DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher);
 
+    /**
+     * This method starts to connect to the system bus and acquire the D-Bus name in the background.
+     *
+     * The connection is taken by `Init()`, so that it is set up while the other subsystems are initialized.
+     *
+     */
+    void Connect(void);
+
     /**
      * This method initializes the dbus agent.
      *
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "DBusAgent"; }
 
 private:
     using Clock                                              = std::chrono::steady_clock;
     constexpr static std::chrono::seconds kDBusWaitAllowance = std::chrono::seconds(30);
 
+    // The maximum number of messages dispatched in a mainloop iteration, the rest are dispatched in the
+    // next iteration so that a flood of requests does not delay the OpenThread controller.
+    constexpr static uint32_t kMaxDispatchesPerProcess = 32;
+
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
 
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
     UniqueDBusConnection PrepareDBusConnection(void);
+    UniqueDBusConnection WaitForDBusConnection(void);
 
     static const struct timeval kPollTimeout;
 
     std::string                       mInterfaceName;
     std::unique_ptr<DBusThreadObject> mThreadObject;
     UniqueDBusConnection              mConnection;
+    std::future<UniqueDBusConnection> mConnectionFuture;
     otbr::Ncp::ControllerOpenThread  &mNcp;
     Mdns::Publisher                  &mPublisher;
 
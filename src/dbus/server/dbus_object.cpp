@@ -43,6 +43,8 @@ using std::placeholders::_1;
 namespace otbr {
 namespace DBus {
 
+constexpr Milliseconds DBusObject::kPropertiesChangedCoalesceDelay;
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
@@ -75,27 +77,45 @@ void DBusObject::RegisterMethod(const std::string       &aInterfaceName,
                                 const std::string       &aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
+    bool added = mMethodHandlers.Add(aInterfaceName, aMethodName, aHandler);
 
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string         &aInterfaceName,
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    mGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
+    mGetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
+}
+
+void DBusObject::RegisterLazyGetPropertyHandler(const std::string         &aInterfaceName,
+                                                const std::string         &aPropertyName,
+                                                const PropertyHandlerType &aHandler)
+{
+    RegisterGetPropertyHandler(aInterfaceName, aPropertyName, aHandler);
+    mLazyGetProperties.Add(aInterfaceName, aPropertyName, true);
+}
+
+void DBusObject::RegisterOffloadedGetPropertyHandler(const std::string                 &aInterfaceName,
+                                                     const std::string                 &aPropertyName,
+                                                     const PropertySnapshotHandlerType &aHandler)
+{
+    bool added = mOffloadedGetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
+
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 void DBusObject::RegisterSetPropertyHandler(const std::string         &aInterfaceName,
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aPropertyName;
+    bool added = mSetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
 
-    assert(mSetPropertyHandlers.find(fullPath) == mSetPropertyHandlers.end());
-    mSetPropertyHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
@@ -107,23 +127,35 @@ DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusM
 
 DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage)
 {
-    DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
-    DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
+    DBusHandlerResult        handled       = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    const char              *interfaceName = dbus_message_get_interface(aMessage);
+    const char              *memberName    = dbus_message_get_member(aMessage);
+    const MethodHandlerType *handler       = nullptr;
+
+    VerifyOrExit(dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL);
+    VerifyOrExit((handler = mMethodHandlers.Find(interfaceName, memberName)) != nullptr);
 
-    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
+    otbrLogInfo("Handling method %s.%s", interfaceName, memberName);
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
     {
-        otbrLogInfo("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            DumpDBusMessage(*aMessage);
-        }
-        (iter->second)(request);
-        handled = DBUS_HANDLER_RESULT_HANDLED;
+        DumpDBusMessage(*aMessage);
+    }
+
+    {
+        DBusRequest request(aConnection, aMessage);
+
+        (*handler)(request);
     }
+    handled = DBUS_HANDLER_RESULT_HANDLED;
 
+    // Any method other than reading properties may change the properties, so the `GetAll` snapshots
+    // must not be reused by the requests handled later in the same mainloop iteration.
+    if (strcmp(interfaceName, DBUS_INTERFACE_PROPERTIES) != 0 || strcmp(memberName, DBUS_PROPERTY_SET_METHOD) == 0)
+    {
+        InvalidateGetAllPropertiesSnapshots();
+    }
+
+exit:
     return handled;
 }
 
@@ -131,37 +163,50 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 {
     UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
 
-    DBusMessageIter iter;
-    std::string     interfaceName;
-    std::string     propertyName;
-    otError         error      = OT_ERROR_NONE;
-    otError         replyError = OT_ERROR_NONE;
+    DBusMessageIter                    iter;
+    const char                        *interfaceName   = "";
+    const char                        *propertyName    = "";
+    const PropertyHandlerType         *handler         = nullptr;
+    const PropertySnapshotHandlerType *snapshotHandler = nullptr;
+    otError                            error           = OT_ERROR_NONE;
+    otError                            replyError      = OT_ERROR_NONE;
+    bool                               offloaded       = false;
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+
+    otbrLogInfo("GetProperty %s.%s", interfaceName, propertyName);
+
+    if ((snapshotHandler = mOffloadedGetPropertyHandlers.Find(interfaceName, propertyName)) != nullptr)
     {
-        auto propertyIter = mGetPropertyHandlers.find(interfaceName);
+        PropertyHandlerType encoder;
 
-        otbrLogInfo("GetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        {
-            DBusMessageIter replyIter;
-            auto           &interfaceHandlers = propertyIter->second;
-            auto            interfaceIter     = interfaceHandlers.find(propertyName);
+        SuccessOrExit(replyError = (*snapshotHandler)(encoder));
+        OffloadGetProperty(aRequest, std::move(reply), std::move(encoder));
+        ExitNow(offloaded = true);
+    }
 
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            dbus_message_iter_init_append(reply.get(), &replyIter);
-            SuccessOrExit(replyError = interfaceIter->second(replyIter));
-        }
+    VerifyOrExit((handler = mGetPropertyHandlers.Find(interfaceName, propertyName)) != nullptr,
+                 error = OT_ERROR_NOT_FOUND);
+    {
+        DBusMessageIter replyIter;
+
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        SuccessOrExit(replyError = (*handler)(replyIter));
     }
+
 exit:
-    if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
+    if (offloaded)
+    {
+        // The reply is sent once the property is encoded.
+    }
+    else if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
     {
         if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
         {
-            otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
+            otbrLogDebug("GetProperty %s.%s reply:", interfaceName, propertyName);
             DumpDBusMessage(*reply);
         }
 
@@ -169,47 +214,81 @@ exit:
     }
     else if (error == OT_ERROR_NONE)
     {
-        otbrLogInfo("GetProperty %s.%s reply:%s", interfaceName.c_str(), propertyName.c_str(),
-                    ConvertToDBusErrorName(replyError));
+        otbrLogInfo("GetProperty %s.%s reply:%s", interfaceName, propertyName, ConvertToDBusErrorName(replyError));
         aRequest.ReplyOtResult(replyError);
     }
     else
     {
-        otbrLogWarning("GetProperty %s.%s error:%s", interfaceName.c_str(), propertyName.c_str(),
-                       ConvertToDBusErrorName(error));
+        otbrLogWarning("GetProperty %s.%s error:%s", interfaceName, propertyName, ConvertToDBusErrorName(error));
         aRequest.ReplyOtResult(error);
     }
 }
 
+void DBusObject::OffloadGetProperty(DBusRequest &aRequest, UniqueDBusMessage aReply, PropertyHandlerType aEncoder)
+{
+    std::shared_ptr<DBusMessage> reply(aReply.release(), dbus_message_unref);
+    DBusRequest                  request(aRequest);
+
+    // Encode on a worker thread so that large properties do not delay the mainloop, which drives the radio.
+    // The message is only accessed by one thread at a time, and libdbus reference counting is thread-safe.
+    mWorkerPool.Post([this, request, reply, aEncoder]() {
+        DBusMessageIter replyIter;
+        otError         error;
+
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        error = aEncoder(replyIter);
+
+        mTaskRunner.Post([request, reply, error]() mutable {
+            if (error == OT_ERROR_NONE)
+            {
+                dbus_connection_send(request.GetConnection(), reply.get(), nullptr);
+            }
+            else
+            {
+                request.ReplyOtResult(error);
+            }
+        });
+    });
+}
+
 void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
 {
-    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
-    DBusMessageIter   iter, subIter, dictEntryIter;
-    std::string       interfaceName;
-    auto              args  = std::tie(interfaceName);
-    otError           error = OT_ERROR_NONE;
+    UniqueDBusMessage reply;
+    DBusMessageIter   iter;
+    const char       *interfaceName = "";
+    otError           error         = OT_ERROR_NONE;
 
-    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
-    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
-    VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-    dbus_message_iter_init_append(reply.get(), &iter);
+    VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_PARSE);
+    VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+    VerifyOrExit(mGetPropertyHandlers.HasInterface(interfaceName), error = OT_ERROR_NOT_FOUND);
 
-    for (auto &p : mGetPropertyHandlers.at(interfaceName))
     {
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OT_ERROR_FAILED);
-        VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+        auto snapshotIter = mGetAllPropertiesSnapshots.find(interfaceName);
+
+        if (snapshotIter == mGetAllPropertiesSnapshots.end())
+        {
+            UniqueDBusMessage snapshot = NewGetAllPropertiesSnapshot(interfaceName);
+
+            VerifyOrExit(snapshot != nullptr, error = OT_ERROR_NO_BUFS);
 
-        SuccessOrExit(error = p.second(dictEntryIter));
+            // The snapshot is only reused by the requests handled in the same mainloop iteration.
+            if (mGetAllPropertiesSnapshots.empty())
+            {
+                mTaskRunner.Post([this]() { InvalidateGetAllPropertiesSnapshots(); });
+            }
+
+            snapshotIter = mGetAllPropertiesSnapshots.emplace(interfaceName, std::move(snapshot)).first;
+        }
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
+        reply = UniqueDBusMessage(dbus_message_copy(snapshotIter->second.get()));
     }
 
+    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(dbus_message_set_reply_serial(reply.get(), dbus_message_get_serial(aRequest.GetMessage())),
+                 error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(dbus_message_set_destination(reply.get(), dbus_message_get_sender(aRequest.GetMessage())),
+                 error = OT_ERROR_NO_BUFS);
+
 exit:
     if (error == OT_ERROR_NONE)
     {
@@ -217,36 +296,94 @@ exit:
     }
     else
     {
+        otbrLogWarning("GetAll %s error:%s", interfaceName, ConvertToDBusErrorName(error));
         aRequest.ReplyOtResult(error);
     }
 }
 
+UniqueDBusMessage DBusObject::NewGetAllPropertiesSnapshot(const char *aInterfaceName)
+{
+    UniqueDBusMessage snapshot(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+    DBusMessageIter   iter, subIter;
+    bool              succeeded = false;
+
+    VerifyOrExit(snapshot != nullptr);
+    dbus_message_iter_init_append(snapshot.get(), &iter);
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter));
+
+    {
+        bool encodeFailed = false;
+
+        mGetPropertyHandlers.ForEach(aInterfaceName, [&](const std::string         &aPropertyName,
+                                                         const PropertyHandlerType &aHandler) -> bool {
+            UniqueDBusMessage value(dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN));
+            DBusMessageIter   valueIter, dictEntryIter;
+            otError           error;
+
+            VerifyOrExit(mLazyGetProperties.Find(aInterfaceName, aPropertyName.c_str()) == nullptr);
+            VerifyOrExit(value != nullptr, encodeFailed = true);
+
+            // Encode the property into a scratch message first, so that the properties which
+            // are not available (e.g. disabled features) are omitted rather than failing `GetAll`.
+            dbus_message_iter_init_append(value.get(), &valueIter);
+            error = aHandler(valueIter);
+            VerifyOrExit(error == OT_ERROR_NONE, otbrLogInfo("GetAll %s.%s omitted, reply:%s", aInterfaceName,
+                                                             aPropertyName.c_str(), ConvertToDBusErrorName(error)));
+            VerifyOrExit(dbus_message_iter_init(value.get(), &valueIter), encodeFailed = true);
+
+            VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                         encodeFailed = true);
+            VerifyOrExit(DBusMessageEncode(&dictEntryIter, aPropertyName) == OTBR_ERROR_NONE, encodeFailed = true);
+            VerifyOrExit(DBusMessageCopy(&valueIter, &dictEntryIter) == OTBR_ERROR_NONE, encodeFailed = true);
+            VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), encodeFailed = true);
+
+        exit:
+            return !encodeFailed;
+        });
+
+        VerifyOrExit(!encodeFailed);
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
+    succeeded = true;
+
+exit:
+    if (!succeeded)
+    {
+        snapshot = nullptr;
+    }
+
+    return snapshot;
+}
+
+void DBusObject::InvalidateGetAllPropertiesSnapshots(void)
+{
+    mGetAllPropertiesSnapshots.clear();
+}
+
 void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
 {
-    DBusMessageIter iter;
-    std::string     interfaceName;
-    std::string     propertyName;
-    std::string     propertyFullPath;
-    otError         error = OT_ERROR_NONE;
+    DBusMessageIter            iter;
+    const char                *interfaceName = "";
+    const char                *propertyName  = "";
+    const PropertyHandlerType *handler       = nullptr;
+    otError                    error         = OT_ERROR_NONE;
 
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
 
-    propertyFullPath = interfaceName + "." + propertyName;
-    otbrLogInfo("SetProperty %s", propertyFullPath.c_str());
-    {
-        auto handlerIter = mSetPropertyHandlers.find(propertyFullPath);
-
-        VerifyOrExit(handlerIter != mSetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        error = handlerIter->second(iter);
-    }
+    otbrLogInfo("SetProperty %s.%s", interfaceName, propertyName);
+    VerifyOrExit((handler = mSetPropertyHandlers.Find(interfaceName, propertyName)) != nullptr,
+                 error = OT_ERROR_NOT_FOUND);
+    error = (*handler)(iter);
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        otbrLogWarning("SetProperty %s.%s error:%s", interfaceName.c_str(), propertyName.c_str(),
-                       ConvertToDBusErrorName(error));
+        otbrLogWarning("SetProperty %s.%s error:%s", interfaceName, propertyName, ConvertToDBusErrorName(error));
     }
     aRequest.ReplyOtResult(error);
     return;
@@ -261,8 +398,90 @@ UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName
     return UniqueDBusMessage(dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
 }
 
+void DBusObject::QueuePropertyChanged(const std::string  &aInterfaceName,
+                                      const std::string  &aPropertyName,
+                                      PropertyHandlerType aEncoder)
+{
+    if (mChangedProperties.empty())
+    {
+        mTaskRunner.Post(kPropertiesChangedCoalesceDelay, [this]() { FlushPropertiesChanged(); });
+    }
+
+    mChangedProperties[aInterfaceName][aPropertyName] = std::move(aEncoder);
+}
+
+otbrError DBusObject::FlushPropertiesChanged(void)
+{
+    otbrError                                error = OTBR_ERROR_NONE;
+    std::map<std::string, ChangedProperties> changedProperties;
+
+    // Swap out the pending properties first so that the encoders may queue new changes.
+    std::swap(changedProperties, mChangedProperties);
+
+    for (const auto &interfaceProperties : changedProperties)
+    {
+        otbrError sendError = SendPropertiesChanged(interfaceProperties.first, interfaceProperties.second);
+
+        if (sendError != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal properties changed on %s: %s", interfaceProperties.first.c_str(),
+                           otbrErrorString(sendError));
+            error = sendError;
+        }
+    }
+
+    return error;
+}
+
+otbrError DBusObject::SendPropertiesChanged(const std::string       &aInterfaceName,
+                                            const ChangedProperties &aChangedProperties)
+{
+    UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+    DBusMessageIter   iter, subIter, dictEntryIter;
+    otbrError         error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const auto &property : aChangedProperties)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, property.first));
+        VerifyOrExit(property.second(dictEntryIter) == OT_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+
+        otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), property.first.c_str());
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        DumpDBusMessage(*signalMsg);
+    }
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 void DBusObject::Flush(void)
 {
+    FlushPropertiesChanged();
     dbus_connection_flush(mConnection);
 }
 
@@ -39,6 +39,7 @@
 #endif
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -46,8 +47,12 @@
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
+#include "common/worker_pool.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_dispatch_table.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
@@ -67,6 +72,8 @@ public:
 
     using PropertyHandlerType = std::function<otError(DBusMessageIter &)>;
 
+    using PropertySnapshotHandlerType = std::function<otError(PropertyHandlerType &aEncoder)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -111,6 +118,37 @@ public:
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler);
 
+    /**
+     * This method registers the get handler for a lazy property.
+     *
+     * A lazy property is expensive to compute, so it is excluded from the replies to
+     * `GetAll` and can only be read with `Get`.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     * @param[in] aHandler        The method handler.
+     *
+     */
+    void RegisterLazyGetPropertyHandler(const std::string         &aInterfaceName,
+                                        const std::string         &aPropertyName,
+                                        const PropertyHandlerType &aHandler);
+
+    /**
+     * This method registers the get handler for a lazy property which is encoded off the mainloop.
+     *
+     * @p aHandler is invoked on the mainloop to take a snapshot of the property, and sets @p aEncoder
+     * to an encoder which owns the snapshot. The encoder is invoked on a worker thread, so it must not
+     * access anything but the snapshot.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     * @param[in] aHandler        The snapshot handler.
+     *
+     */
+    virtual void RegisterOffloadedGetPropertyHandler(const std::string                 &aInterfaceName,
+                                                     const std::string                 &aPropertyName,
+                                                     const PropertySnapshotHandlerType &aHandler);
+
     /**
      * This method registers the set handler for a property.
      *
@@ -154,12 +192,16 @@ public:
     /**
      * This method sends a property changed signal.
      *
+     * The changed property is not sent immediately. All properties changed within
+     * `kPropertiesChangedCoalesceDelay` are emitted in a single `PropertiesChanged`
+     * signal per interface. If the same property changes more than once, only the
+     * last value is emitted.
+     *
      * @param[in] aInterfaceName  The interface name.
      * @param[in] aPropertyName   The property name.
      * @param[in] aValue          New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
-     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     * @retval OTBR_ERROR_NONE  Signal successfully queued.
      *
      */
     template <typename ValueType>
@@ -167,44 +209,36 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType   &aValue)
     {
-        UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
-        DBusMessageIter   iter, subIter, dictEntryIter;
-        otbrError         error = OTBR_ERROR_NONE;
-
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        QueuePropertyChanged(aInterfaceName, aPropertyName, [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue) == OTBR_ERROR_NONE ? OT_ERROR_NONE : OT_ERROR_FAILED;
+        });
 
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
-
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
-
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
-
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
-        }
+        return OTBR_ERROR_NONE;
+    }
 
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+    /**
+     * This method queues a property changed signal whose value is encoded by @p aEncoder.
+     *
+     * @p aEncoder is invoked when the coalesced `PropertiesChanged` signal is built, so it
+     * should encode the value of the property at that time, as a variant.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     * @param[in] aEncoder        The encoder of the property value.
+     *
+     */
+    void QueuePropertyChanged(const std::string  &aInterfaceName,
+                              const std::string  &aPropertyName,
+                              PropertyHandlerType aEncoder);
 
-    exit:
-        return error;
-    }
+    /**
+     * This method immediately sends all queued property changed signals.
+     *
+     * @retval OTBR_ERROR_NONE  Signals successfully sent.
+     * @retval OTBR_ERROR_DBUS  Failed to send some of the signals.
+     *
+     */
+    otbrError FlushPropertiesChanged(void);
 
     /**
      * The destructor of a d-bus object.
@@ -215,10 +249,46 @@ public:
     /**
      * Sends all outgoing messages, blocks until the message queue is empty.
      *
+     * Queued property changed signals are sent before flushing.
+     *
      */
     void Flush(void);
 
+protected:
+    /**
+     * This method returns the task runner of the d-bus object.
+     *
+     * @returns A reference to the task runner.
+     *
+     */
+    TaskRunner &GetTaskRunner(void) { return mTaskRunner; }
+
+    /**
+     * This method returns an encoder of a property value, as a variant.
+     *
+     * @param[in] aValue  The property value, which is owned by the encoder.
+     *
+     * @returns The encoder of the property value.
+     *
+     */
+    template <typename ValueType> static PropertyHandlerType MakePropertyEncoder(ValueType aValue)
+    {
+        return [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue) == OTBR_ERROR_NONE ? OT_ERROR_NONE
+                                                                                 : OT_ERROR_INVALID_ARGS;
+        };
+    }
+
 private:
+    static constexpr Milliseconds kPropertiesChangedCoalesceDelay = Milliseconds(100);
+
+    using ChangedProperties = std::map<std::string, PropertyHandlerType>;
+
+    otbrError SendPropertiesChanged(const std::string &aInterfaceName, const ChangedProperties &aChangedProperties);
+    UniqueDBusMessage NewGetAllPropertiesSnapshot(const char *aInterfaceName);
+    void              InvalidateGetAllPropertiesSnapshots(void);
+    void              OffloadGetProperty(DBusRequest &aRequest, UniqueDBusMessage aReply, PropertyHandlerType aEncoder);
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
     void GetPropertyMethodHandler(DBusRequest &aRequest);
     void SetPropertyMethodHandler(DBusRequest &aRequest);
@@ -228,11 +298,19 @@ private:
 
     UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
-    std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
-    DBusConnection                                                                       *mConnection;
-    std::string                                                                           mObjectPath;
+    DBusDispatchTable<MethodHandlerType>           mMethodHandlers;
+    DBusDispatchTable<PropertyHandlerType>         mGetPropertyHandlers;
+    DBusDispatchTable<PropertySnapshotHandlerType> mOffloadedGetPropertyHandlers;
+    DBusDispatchTable<PropertyHandlerType>         mSetPropertyHandlers;
+    DBusDispatchTable<bool>                        mLazyGetProperties;
+    DBusConnection                                *mConnection;
+    std::string                                    mObjectPath;
+    std::map<std::string, ChangedProperties>       mChangedProperties;
+    std::map<std::string, UniqueDBusMessage>       mGetAllPropertiesSnapshots;
+    TaskRunner                                     mTaskRunner;
+
+    // The worker pool is destroyed first, so the running encoders can still post to the task runner.
+    WorkerPool mWorkerPool;
 };
 
 } // namespace DBus
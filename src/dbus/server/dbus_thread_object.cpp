@@ -26,6 +26,8 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory>
+
 #include <assert.h>
 #include <net/if.h>
 #include <string.h>
@@ -45,6 +47,7 @@
 #include <openthread/platform/radio.h>
 
 #include "common/byteswap.hpp"
+#include "common/startup_timeline.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
@@ -120,6 +123,8 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
 namespace otbr {
 namespace DBus {
 
+constexpr Milliseconds DBusThreadObject::kCountersChangedInterval;
+
 DBusThreadObject::DBusThreadObject(DBusConnection                  *aConnection,
                                    const std::string               &aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp,
@@ -227,22 +232,25 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetRouterIdHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LEADER_DATA,
                                std::bind(&DBusThreadObject::GetLeaderDataHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
-                               std::bind(&DBusThreadObject::GetNetworkDataHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
-                               std::bind(&DBusThreadObject::GetStableNetworkDataHandler, this, _1));
+    RegisterLazyGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
+                                   std::bind(&DBusThreadObject::GetNetworkDataHandler, this, _1));
+    RegisterLazyGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
+                                   std::bind(&DBusThreadObject::GetStableNetworkDataHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT,
                                std::bind(&DBusThreadObject::GetLocalLeaderWeightHandler, this, _1));
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_SAMPLE_COUNT,
                                std::bind(&DBusThreadObject::GetChannelMonitorSampleCountHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
-                               std::bind(&DBusThreadObject::GetChannelMonitorAllChannelQualities, this, _1));
+    RegisterLazyGetPropertyHandler(
+        OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
+        std::bind(&DBusThreadObject::GetChannelMonitorAllChannelQualities, this, _1));
 #endif
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE,
-                               std::bind(&DBusThreadObject::GetChildTableHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
-                               std::bind(&DBusThreadObject::GetNeighborTableHandler, this, _1));
+    RegisterOffloadedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE,
+                                        std::bind(&DBusThreadObject::GetChildTableHandler, this, _1));
+    RegisterOffloadedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+                                        std::bind(&DBusThreadObject::GetNeighborTableHandler, this, _1));
+    RegisterOffloadedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TOPOLOGY,
+                                        std::bind(&DBusThreadObject::GetTopologyHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
                                std::bind(&DBusThreadObject::GetPartitionIDHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INSTANT_RSSI,
@@ -283,17 +291,24 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetBorderRoutingCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_STATE,
                                std::bind(&DBusThreadObject::GetNat64State, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_MAPPINGS,
-                               std::bind(&DBusThreadObject::GetNat64Mappings, this, _1));
+    RegisterLazyGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_MAPPINGS,
+                                   std::bind(&DBusThreadObject::GetNat64Mappings, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_PROTOCOL_COUNTERS,
                                std::bind(&DBusThreadObject::GetNat64ProtocolCounters, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS,
                                std::bind(&DBusThreadObject::GetNat64ErrorCounters, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INFRA_LINK_INFO,
                                std::bind(&DBusThreadObject::GetInfraLinkInfo, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STARTUP_TIMELINE,
+                               std::bind(&DBusThreadObject::GetStartupTimelineHandler, this, _1));
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
+    if (kCountersChangedInterval > Milliseconds::zero())
+    {
+        GetTaskRunner().Post(kCountersChangedInterval, [this]() { SignalCountersChanged(); });
+    }
+
 exit:
     return error;
 }
@@ -312,6 +327,65 @@ void DBusThreadObject::NcpResetHandler(void)
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
+void DBusThreadObject::SignalCountersChanged(void)
+{
+    static const char *const kCounterProperties[] = {
+        OTBR_DBUS_PROPERTY_LINK_COUNTERS,
+        OTBR_DBUS_PROPERTY_IP6_COUNTERS,
+        OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
+        OTBR_DBUS_PROPERTY_BORDER_ROUTING_COUNTERS,
+        OTBR_DBUS_PROPERTY_NAT64_PROTOCOL_COUNTERS,
+        OTBR_DBUS_PROPERTY_NAT64_ERROR_COUNTERS,
+    };
+
+    // Counters change too often to signal on every change, so they are sampled
+    // periodically and only those that differ from the last sample are signaled.
+    // The sample itself is signaled, so each counter is read once per period.
+    for (const char *propertyName : kCounterProperties)
+    {
+        auto              handlerIter = mGetPropertyHandlers.find(propertyName);
+        UniqueDBusMessage sample(dbus_message_new_signal("/", OTBR_DBUS_THREAD_INTERFACE, propertyName));
+        DBusMessageIter   iter;
+        char             *data   = nullptr;
+        int               length = 0;
+
+        if (handlerIter == mGetPropertyHandlers.end() || sample == nullptr)
+        {
+            continue;
+        }
+
+        dbus_message_iter_init_append(sample.get(), &iter);
+
+        if (handlerIter->second(iter) != OT_ERROR_NONE || !dbus_message_marshal(sample.get(), &data, &length))
+        {
+            continue;
+        }
+
+        {
+            std::vector<uint8_t> &snapshot = mCountersSnapshot[propertyName];
+
+            if (snapshot.size() != static_cast<size_t>(length) || memcmp(snapshot.data(), data, snapshot.size()) != 0)
+            {
+                std::shared_ptr<DBusMessage> value(std::move(sample));
+
+                snapshot.assign(data, data + length);
+                QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, propertyName, [value](DBusMessageIter &aIter) {
+                    DBusMessageIter valueIter;
+
+                    return dbus_message_iter_init(value.get(), &valueIter) &&
+                                   DBusMessageCopy(&valueIter, &aIter) == OTBR_ERROR_NONE
+                               ? OT_ERROR_NONE
+                               : OT_ERROR_FAILED;
+                });
+            }
+        }
+
+        dbus_free(data);
+    }
+
+    GetTaskRunner().Post(kCountersChangedInterval, [this]() { SignalCountersChanged(); });
+}
+
 void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
 {
     auto threadHelper = mNcp->GetThreadHelper();
@@ -999,10 +1073,9 @@ exit:
 #endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 }
 
-otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
+otError DBusThreadObject::GetChildTableHandler(PropertyHandlerType &aEncoder)
 {
     auto                   threadHelper = mNcp->GetThreadHelper();
-    otError                error        = OT_ERROR_NONE;
     uint16_t               childIndex   = 0;
     otChildInfo            childInfo;
     std::vector<ChildInfo> childTable;
@@ -1029,16 +1102,14 @@ otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
         childIndex++;
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, childTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    aEncoder = MakePropertyEncoder(std::move(childTable));
 
-exit:
-    return error;
+    return OT_ERROR_NONE;
 }
 
-otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
+otError DBusThreadObject::GetNeighborTableHandler(PropertyHandlerType &aEncoder)
 {
     auto                      threadHelper = mNcp->GetThreadHelper();
-    otError                   error        = OT_ERROR_NONE;
     otNeighborInfoIterator    iter         = OT_NEIGHBOR_INFO_ITERATOR_INIT;
     otNeighborInfo            neighborInfo;
     std::vector<NeighborInfo> neighborTable;
@@ -1065,10 +1136,59 @@ otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
         neighborTable.push_back(info);
     }
 
-    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    aEncoder = MakePropertyEncoder(std::move(neighborTable));
 
-exit:
-    return error;
+    return OT_ERROR_NONE;
+}
+
+otError DBusThreadObject::GetTopologyHandler(PropertyHandlerType &aEncoder)
+{
+    const agent::TopologyModel &topologyModel = mNcp->GetThreadHelper()->GetTopologyModel();
+    Timepoint                   now           = Clock::now();
+    std::vector<TopologyNode>   topology;
+
+    // The topology is read from the model, which does not send any diagnostic query.
+    for (const auto &entry : topologyModel.GetNodes())
+    {
+        const agent::TopologyModel::Node &node = entry.second;
+        TopologyNode                      info;
+
+        info.mRloc16             = node.mRloc16;
+        info.mExtAddress         = ConvertOpenThreadUint64(node.mExtAddress.m8);
+        info.mMode.mRxOnWhenIdle = node.mMode.mRxOnWhenIdle;
+        info.mMode.mDeviceType   = node.mMode.mDeviceType;
+        info.mMode.mNetworkData  = node.mMode.mNetworkData;
+        info.mAge                = std::chrono::duration_cast<Seconds>(now - node.mUpdateTime).count();
+
+        for (const agent::TopologyModel::Route &route : node.mRoutes)
+        {
+            TopologyRoute routeInfo;
+
+            routeInfo.mRouterRloc16   = route.mRouterRloc16;
+            routeInfo.mLinkQualityIn  = route.mLinkQualityIn;
+            routeInfo.mLinkQualityOut = route.mLinkQualityOut;
+            routeInfo.mRouteCost      = route.mRouteCost;
+            info.mRoutes.push_back(routeInfo);
+        }
+
+        for (const agent::TopologyModel::Child &child : node.mChildren)
+        {
+            TopologyChild childInfo;
+
+            childInfo.mRloc16             = child.mRloc16;
+            childInfo.mTimeout            = child.mTimeout;
+            childInfo.mMode.mRxOnWhenIdle = child.mMode.mRxOnWhenIdle;
+            childInfo.mMode.mDeviceType   = child.mMode.mDeviceType;
+            childInfo.mMode.mNetworkData  = child.mMode.mNetworkData;
+            info.mChildren.push_back(childInfo);
+        }
+
+        topology.push_back(std::move(info));
+    }
+
+    aEncoder = MakePropertyEncoder(std::move(topology));
+
+    return OT_ERROR_NONE;
 }
 
 otError DBusThreadObject::GetPartitionIDHandler(DBusMessageIter &aIter)
@@ -1455,6 +1575,25 @@ void DBusThreadObject::RegisterGetPropertyHandler(const std::string         &aIn
     mGetPropertyHandlers[aPropertyName] = aHandler;
 }
 
+void DBusThreadObject::RegisterOffloadedGetPropertyHandler(const std::string                 &aInterfaceName,
+                                                           const std::string                 &aPropertyName,
+                                                           const PropertySnapshotHandlerType &aHandler)
+{
+    DBusObject::RegisterOffloadedGetPropertyHandler(aInterfaceName, aPropertyName, aHandler);
+
+    // `GetProperties` replies all the properties in one message, so the snapshot is encoded inline.
+    mGetPropertyHandlers[aPropertyName] = [aHandler](DBusMessageIter &aIter) {
+        PropertyHandlerType encoder;
+        otError             error;
+
+        SuccessOrExit(error = aHandler(encoder));
+        error = encoder(aIter);
+
+    exit:
+        return error;
+    };
+}
+
 otError DBusThreadObject::GetOtHostVersionHandler(DBusMessageIter &aIter)
 {
     otError     error   = OT_ERROR_NONE;
@@ -1845,6 +1984,22 @@ exit:
 #endif
 }
 
+otError DBusThreadObject::GetStartupTimelineHandler(DBusMessageIter &aIter)
+{
+    otError                       error = OT_ERROR_NONE;
+    std::vector<StartupMilestone> timeline;
+
+    for (const StartupTimeline::Milestone &milestone : StartupTimeline::GetInstance().GetMilestones())
+    {
+        timeline.push_back({milestone.mName, static_cast<uint64_t>(milestone.mElapsed.count())});
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, timeline) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 static_assert(OTBR_SRP_SERVER_STATE_DISABLED == static_cast<uint8_t>(OT_SRP_SERVER_STATE_DISABLED),
               "OTBR_SRP_SERVER_STATE_DISABLED value is incorrect");
 static_assert(OTBR_SRP_SERVER_STATE_RUNNING == static_cast<uint8_t>(OT_SRP_SERVER_STATE_RUNNING),
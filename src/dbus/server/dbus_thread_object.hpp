@@ -34,7 +34,9 @@
 #ifndef OTBR_DBUS_THREAD_OBJECT_HPP_
 #define OTBR_DBUS_THREAD_OBJECT_HPP_
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include <openthread/link.h>
 
@@ -42,6 +44,14 @@
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
 
+/**
+ * The period in milliseconds of signaling changed counters, 0 to disable.
+ *
+ */
+#ifndef OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL
+#define OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL 1000
+#endif
+
 namespace otbr {
 namespace DBus {
 
@@ -81,10 +91,17 @@ public:
                                     const std::string         &aPropertyName,
                                     const PropertyHandlerType &aHandler) override;
 
+    void RegisterOffloadedGetPropertyHandler(const std::string                 &aInterfaceName,
+                                             const std::string                 &aPropertyName,
+                                             const PropertySnapshotHandlerType &aHandler) override;
+
 private:
+    static constexpr Milliseconds kCountersChangedInterval = Milliseconds(OTBR_DBUS_COUNTERS_SIGNAL_INTERVAL);
+
     void DeviceRoleHandler(otDeviceRole aDeviceRole);
     void ActiveDatasetChangeHandler(const otOperationalDatasetTlvs &aDatasetTlvs);
     void NcpResetHandler(void);
+    void SignalCountersChanged(void);
 
     void ScanHandler(DBusRequest &aRequest);
     void EnergyScanHandler(DBusRequest &aRequest);
@@ -137,8 +154,9 @@ private:
     otError GetLocalLeaderWeightHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorSampleCountHandler(DBusMessageIter &aIter);
     otError GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter);
-    otError GetChildTableHandler(DBusMessageIter &aIter);
-    otError GetNeighborTableHandler(DBusMessageIter &aIter);
+    otError GetChildTableHandler(PropertyHandlerType &aEncoder);
+    otError GetNeighborTableHandler(PropertyHandlerType &aEncoder);
+    otError GetTopologyHandler(PropertyHandlerType &aEncoder);
     otError GetPartitionIDHandler(DBusMessageIter &aIter);
     otError GetInstantRssiHandler(DBusMessageIter &aIter);
     otError GetRadioTxPowerHandler(DBusMessageIter &aIter);
@@ -163,6 +181,7 @@ private:
     otError GetNat64ProtocolCounters(DBusMessageIter &aIter);
     otError GetNat64ErrorCounters(DBusMessageIter &aIter);
     otError GetInfraLinkInfo(DBusMessageIter &aIter);
+    otError GetStartupTimelineHandler(DBusMessageIter &aIter);
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
     void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
@@ -170,6 +189,7 @@ private:
     otbr::Ncp::ControllerOpenThread                     *mNcp;
     std::unordered_map<std::string, PropertyHandlerType> mGetPropertyHandlers;
     otbr::Mdns::Publisher                               *mPublisher;
+    std::map<std::string, std::vector<uint8_t>>          mCountersSnapshot;
 };
 
 } // namespace DBus
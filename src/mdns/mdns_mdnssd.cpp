@@ -217,6 +217,7 @@ PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
     : mHostsRef(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
+    , mNextReadyOffset(0)
 {
 }
 
@@ -338,6 +339,8 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         host->Process(aMainloop, readyServices);
     }
 
+    TakeWithinBudget(readyServices, kMaxResultsPerProcess, mNextReadyOffset);
+
     for (DNSServiceRef serviceRef : readyServices)
     {
         DNSServiceErrorType error = DNSServiceProcessResult(serviceRef);
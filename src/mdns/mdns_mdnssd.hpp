@@ -78,8 +78,9 @@ public:
 
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void        Update(MainloopContext &aMainloop) override;
+    void        Process(const MainloopContext &aMainloop) override;
+    const char *GetName(void) const override { return "PublisherMDnsSd"; }
 
 protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
@@ -101,6 +102,10 @@ protected:
 private:
     static constexpr uint32_t kDefaultTtl = 10;
 
+    // The maximum number of service refs whose results are processed in a mainloop iteration. The sockets
+    // of the other ready refs stay readable, so they are processed in the next iterations.
+    static constexpr size_t kMaxResultsPerProcess = 16;
+
     class DnssdServiceRegistration : public ServiceRegistration
     {
     public:
@@ -349,6 +354,7 @@ private:
     DNSServiceRef mHostsRef;
     State         mState;
     StateCallback mStateCallback;
+    size_t        mNextReadyOffset;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
@@ -0,0 +1,639 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the in-process mock mDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_mock.hpp"
+
+#include <sstream>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+PublisherMock::PublisherMock(StateCallback aCallback, const Config &aConfig)
+    : mStateCallback(std::move(aCallback))
+    , mState(State::kIdle)
+    , mConfig(aConfig)
+    , mRandom(aConfig.mSeed)
+    , mNextRegistrationId(1)
+{
+}
+
+PublisherMock::~PublisherMock(void)
+{
+    Stop();
+}
+
+void PublisherMock::SetConfig(const Config &aConfig)
+{
+    mConfig = aConfig;
+    mRandom.seed(aConfig.mSeed);
+}
+
+void PublisherMock::AddRemoteService(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    ServiceKey key(aType, aInstanceInfo.mName);
+
+    mRemoteServices[key] = aInstanceInfo;
+
+    if (IsServiceSubscribed(aType, "") || IsServiceSubscribed(aType, aInstanceInfo.mName))
+    {
+        Report([this, key]() { ResolveService(key.first, key.second); });
+    }
+}
+
+void PublisherMock::AddRemoteHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    mRemoteHosts[aHostName] = aHostInfo;
+
+    if (mSubscribedHosts.count(aHostName) != 0)
+    {
+        Report([this, aHostName]() { ResolveHost(aHostName); });
+    }
+}
+
+otbrError PublisherMock::Start(void)
+{
+    mState = State::kReady;
+    mStateCallback(State::kReady);
+    return OTBR_ERROR_NONE;
+}
+
+void PublisherMock::Stop(void)
+{
+    ServiceRegistrationMap serviceRegistrations;
+    HostRegistrationMap    hostRegistrations;
+
+    VerifyOrExit(mState == State::kReady);
+
+    // The registrations are aborted when they are destroyed, which may publish new ones in the callbacks.
+    std::swap(mServiceRegistrations, serviceRegistrations);
+    std::swap(mHostRegistrations, hostRegistrations);
+
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
+
+    mState = State::kIdle;
+
+exit:
+    return;
+}
+
+bool PublisherMock::IsStarted(void) const
+{
+    return mState == State::kReady;
+}
+
+otbrError PublisherMock::PublishServiceImpl(const std::string &aHostName,
+                                            const std::string &aName,
+                                            const std::string &aType,
+                                            const SubTypeList &aSubTypeList,
+                                            uint16_t           aPort,
+                                            const TxtList     &aTxtList,
+                                            ResultCallback   &&aCallback)
+{
+    otbrError            error             = OTBR_ERROR_NONE;
+    SubTypeList          sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    TxtList              sortedTxtList     = SortTxtList(aTxtList);
+    std::vector<uint8_t> txt;
+    uint64_t             id;
+    otbrError            result;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, sortedTxtList,
+                                                   std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+
+    SuccessOrExit(error = EncodeTxtData(aTxtList, txt));
+
+    id     = mNextRegistrationId++;
+    result = ShouldFail() ? mConfig.mFailureError : OTBR_ERROR_NONE;
+    AddServiceRegistration(ServiceRegistrationPtr(new MockServiceRegistration(
+        aHostName, aName, aType, sortedSubTypeList, aPort, sortedTxtList, std::move(aCallback), id, this)));
+
+    Report([this, aName, aType, id, result]() { HandleServiceResult(aName, aType, id, result); });
+
+exit:
+    if (error != OTBR_ERROR_NONE && !aCallback.IsNull())
+    {
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherMock::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    bool      subscribed;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    subscribed = FindServiceRegistration(aName, aType) != nullptr && IsServiceSubscribed(aType, aName);
+    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+
+    if (subscribed)
+    {
+        Report([this, aName, aType]() {
+            if (IsServiceSubscribed(aType, aName))
+            {
+                OnServiceRemoved(kNetifIndex, aType, aName);
+            }
+        });
+    }
+
+exit:
+    std::move(aCallback)(error);
+}
+
+otbrError PublisherMock::PublishHostImpl(const std::string             &aName,
+                                         const std::vector<Ip6Address> &aAddresses,
+                                         ResultCallback               &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint64_t  id;
+    otbrError result;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+
+    aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+    VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
+
+    id     = mNextRegistrationId++;
+    result = ShouldFail() ? mConfig.mFailureError : OTBR_ERROR_NONE;
+    AddHostRegistration(
+        HostRegistrationPtr(new MockHostRegistration(aName, aAddresses, std::move(aCallback), id, this)));
+
+    Report([this, aName, id, result]() { HandleHostResult(aName, id, result); });
+
+exit:
+    if (error != OTBR_ERROR_NONE && !aCallback.IsNull())
+    {
+        std::move(aCallback)(error);
+    }
+    return error;
+}
+
+void PublisherMock::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+
+exit:
+    std::move(aCallback)(error);
+}
+
+void PublisherMock::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedServices.emplace(aType, aInstanceName);
+
+    Report([this, aType, aInstanceName]() { ResolveService(aType, aInstanceName); });
+
+exit:
+    return;
+}
+
+void PublisherMock::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    mSubscribedServices.erase(ServiceKey(aType, aInstanceName));
+}
+
+void PublisherMock::SubscribeHost(const std::string &aHostName)
+{
+    VerifyOrExit(mState == State::kReady);
+    mSubscribedHosts.insert(aHostName);
+
+    Report([this, aHostName]() { ResolveHost(aHostName); });
+
+exit:
+    return;
+}
+
+void PublisherMock::UnsubscribeHost(const std::string &aHostName)
+{
+    mSubscribedHosts.erase(aHostName);
+}
+
+void PublisherMock::OnServiceResolveFailedImpl(const std::string &aType,
+                                               const std::string &aInstanceName,
+                                               int32_t            aErrorCode)
+{
+    otbrLogDebug("Failed to resolve service instance %s.%s: %s", aInstanceName.c_str(), aType.c_str(),
+                 otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+void PublisherMock::OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode)
+{
+    otbrLogDebug("Failed to resolve host %s: %s", aHostName.c_str(),
+                 otbrErrorString(static_cast<otbrError>(aErrorCode)));
+}
+
+otbrError PublisherMock::DnsErrorToOtbrError(int32_t aErrorCode)
+{
+    // The mock publisher reports the errors in otbrError.
+    return static_cast<otbrError>(aErrorCode);
+}
+
+bool PublisherMock::ShouldFail(void)
+{
+    return mConfig.mFailureRate > 0 && mRandom() % 100 < mConfig.mFailureRate;
+}
+
+void PublisherMock::Report(TaskRunner::Task<void> aTask)
+{
+    if (mConfig.mLatency == Milliseconds::zero())
+    {
+        aTask();
+    }
+    else
+    {
+        mTaskRunner.Post(mConfig.mLatency, std::move(aTask));
+    }
+}
+
+void PublisherMock::HandleServiceResult(const std::string &aName,
+                                        const std::string &aType,
+                                        uint64_t           aId,
+                                        otbrError          aError)
+{
+    auto *serviceReg = static_cast<MockServiceRegistration *>(FindServiceRegistration(aName, aType));
+
+    // The registration may have been removed or replaced.
+    VerifyOrExit(serviceReg != nullptr && serviceReg->mId == aId && !serviceReg->IsCompleted());
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        RemoveServiceRegistration(aName, aType, aError);
+        ExitNow();
+    }
+
+    serviceReg->Complete(OTBR_ERROR_NONE);
+
+    // Browsers of the service type and resolvers of the service instance discover the new instance.
+    ResolveService(aType, aName);
+
+exit:
+    return;
+}
+
+void PublisherMock::HandleHostResult(const std::string &aName, uint64_t aId, otbrError aError)
+{
+    auto *hostReg = static_cast<MockHostRegistration *>(FindHostRegistration(aName));
+
+    VerifyOrExit(hostReg != nullptr && hostReg->mId == aId && !hostReg->IsCompleted());
+
+    if (aError != OTBR_ERROR_NONE)
+    {
+        RemoveHostRegistration(aName, aError);
+        ExitNow();
+    }
+
+    hostReg->Complete(OTBR_ERROR_NONE);
+
+    if (mSubscribedHosts.count(aName) != 0)
+    {
+        ResolveHost(aName);
+    }
+
+exit:
+    return;
+}
+
+void PublisherMock::ResolveService(const std::string &aType, const std::string &aInstanceName)
+{
+    std::vector<DiscoveredInstanceInfo> instances;
+    DiscoveredInstanceInfo              instanceInfo;
+
+    // The subscription may have been canceled during the latency.
+    VerifyOrExit(IsServiceSubscribed(aType, aInstanceName) || IsServiceSubscribed(aType, ""));
+
+    if (ShouldFail())
+    {
+        OnServiceResolveFailed(aType, aInstanceName, mConfig.mFailureError);
+        ExitNow();
+    }
+
+    if (aInstanceName.empty())
+    {
+        for (const auto &kv : mServiceRegistrations)
+        {
+            if (kv.second->mType == aType && MakeLocalInstanceInfo(*kv.second, instanceInfo))
+            {
+                instances.push_back(instanceInfo);
+            }
+        }
+    }
+    else
+    {
+        const ServiceRegistration *serviceReg = FindServiceRegistration(aInstanceName, aType);
+
+        if (serviceReg != nullptr && MakeLocalInstanceInfo(*serviceReg, instanceInfo))
+        {
+            instances.push_back(instanceInfo);
+        }
+    }
+
+    for (auto iter = mRemoteServices.lower_bound(ServiceKey(aType, aInstanceName));
+         iter != mRemoteServices.end() && iter->first.first == aType; ++iter)
+    {
+        if (!aInstanceName.empty() && iter->first.second != aInstanceName)
+        {
+            break;
+        }
+
+        instances.push_back(iter->second);
+    }
+
+    for (const DiscoveredInstanceInfo &instance : instances)
+    {
+        OnServiceResolved(aType, instance);
+    }
+
+exit:
+    return;
+}
+
+void PublisherMock::ResolveHost(const std::string &aHostName)
+{
+    DiscoveredHostInfo hostInfo;
+    HostRegistration  *hostReg;
+    auto               remoteHost = mRemoteHosts.find(aHostName);
+
+    VerifyOrExit(mSubscribedHosts.count(aHostName) != 0);
+
+    if (ShouldFail())
+    {
+        OnHostResolveFailed(aHostName, mConfig.mFailureError);
+        ExitNow();
+    }
+
+    hostReg = FindHostRegistration(aHostName);
+
+    if (hostReg != nullptr && hostReg->IsCompleted())
+    {
+        hostInfo.mHostName  = MakeFullHostName(aHostName) + ".";
+        hostInfo.mAddresses = hostReg->mAddresses;
+        hostInfo.mTtl       = kTtl;
+        OnHostResolved(aHostName, hostInfo);
+    }
+    else if (remoteHost != mRemoteHosts.end())
+    {
+        OnHostResolved(aHostName, remoteHost->second);
+    }
+
+exit:
+    return;
+}
+
+bool PublisherMock::IsServiceSubscribed(const std::string &aType, const std::string &aInstanceName) const
+{
+    return mSubscribedServices.count(ServiceKey(aType, aInstanceName)) != 0;
+}
+
+bool PublisherMock::MakeLocalInstanceInfo(const ServiceRegistration &aServiceReg,
+                                          DiscoveredInstanceInfo    &aInstanceInfo) const
+{
+    bool                    found   = false;
+    const HostRegistration *hostReg = nullptr;
+    auto                    iter    = mHostRegistrations.find(MakeFullHostName(aServiceReg.mHostName));
+
+    VerifyOrExit(aServiceReg.IsCompleted());
+
+    if (iter != mHostRegistrations.end())
+    {
+        hostReg = iter->second.get();
+    }
+
+    aInstanceInfo             = DiscoveredInstanceInfo();
+    aInstanceInfo.mNetifIndex = kNetifIndex;
+    aInstanceInfo.mName       = aServiceReg.mName;
+    aInstanceInfo.mHostName =
+        MakeFullHostName(aServiceReg.mHostName.empty() ? "localhost" : aServiceReg.mHostName) + ".";
+    aInstanceInfo.mPort = aServiceReg.mPort;
+    aInstanceInfo.mTtl  = kTtl;
+
+    if (hostReg != nullptr)
+    {
+        aInstanceInfo.mAddresses = hostReg->mAddresses;
+    }
+
+    SuccessOrExit(EncodeTxtData(aServiceReg.mTxtList, aInstanceInfo.mTxtData));
+    found = true;
+
+exit:
+    return found;
+}
+
+PublisherReplayer::PublisherReplayer(Publisher &aPublisher)
+    : mPublisher(aPublisher)
+{
+    mSubscriberId = mPublisher.AddSubscriptionCallbacks(
+        [this](const std::string &, const Publisher::DiscoveredInstanceInfo &) { ++mCounters.mInstances; },
+        [this](const std::string &, const Publisher::DiscoveredHostInfo &) { ++mCounters.mHosts; });
+}
+
+PublisherReplayer::~PublisherReplayer(void)
+{
+    mPublisher.RemoveSubscriptionCallbacks(mSubscriberId);
+}
+
+otbrError PublisherReplayer::Load(std::istream &aTrace)
+{
+    otbrError              error = OTBR_ERROR_NONE;
+    std::vector<Operation> operations;
+    std::string            line;
+    size_t                 lineNumber = 0;
+
+    while (std::getline(aTrace, line))
+    {
+        Operation operation;
+
+        ++lineNumber;
+
+        if (line.find_first_not_of(" \t\r") == std::string::npos || line[line.find_first_not_of(" \t")] == '#')
+        {
+            continue;
+        }
+
+        error = ParseOperation(line, operation);
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Invalid operation at line %zu: %s", lineNumber, line.c_str());
+            ExitNow();
+        }
+
+        operations.push_back(std::move(operation));
+    }
+
+    mOperations = std::move(operations);
+
+exit:
+    return error;
+}
+
+void PublisherReplayer::Replay(void)
+{
+    for (const Operation &operation : mOperations)
+    {
+        ++mCounters.mOperations;
+
+        switch (operation.mType)
+        {
+        case Type::kPublishHost:
+            mPublisher.PublishHost(operation.mHostName, operation.mAddresses, MakeResultCallback());
+            break;
+
+        case Type::kUnpublishHost:
+            mPublisher.UnpublishHost(operation.mHostName, MakeResultCallback());
+            break;
+
+        case Type::kPublishService:
+            mPublisher.PublishService(operation.mHostName, operation.mName, operation.mServiceType, {}, operation.mPort,
+                                      operation.mTxtList, MakeResultCallback());
+            break;
+
+        case Type::kUnpublishService:
+            mPublisher.UnpublishService(operation.mName, operation.mServiceType, MakeResultCallback());
+            break;
+
+        // The results of the subscriptions are counted as the discovered instances and hosts.
+        case Type::kSubscribeService:
+            mPublisher.SubscribeService(operation.mServiceType, operation.mName);
+            ++mCounters.mSucceeded;
+            break;
+
+        case Type::kUnsubscribeService:
+            mPublisher.UnsubscribeService(operation.mServiceType, operation.mName);
+            ++mCounters.mSucceeded;
+            break;
+
+        case Type::kSubscribeHost:
+            mPublisher.SubscribeHost(operation.mHostName);
+            ++mCounters.mSucceeded;
+            break;
+
+        case Type::kUnsubscribeHost:
+            mPublisher.UnsubscribeHost(operation.mHostName);
+            ++mCounters.mSucceeded;
+            break;
+        }
+    }
+}
+
+Publisher::ResultCallback PublisherReplayer::MakeResultCallback(void)
+{
+    return [this](otbrError aError) { ++(aError == OTBR_ERROR_NONE ? mCounters.mSucceeded : mCounters.mFailed); };
+}
+
+otbrError PublisherReplayer::ParseOperation(const std::string &aLine, Operation &aOperation)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    std::istringstream fields(aLine);
+    std::string        command;
+    std::string        field;
+    unsigned long      port;
+
+    fields >> command;
+
+    if (command == "publish-host" || command == "unpublish-host" || command == "subscribe-host" ||
+        command == "unsubscribe-host")
+    {
+        aOperation.mType = command == "publish-host"     ? Type::kPublishHost
+                           : command == "unpublish-host" ? Type::kUnpublishHost
+                           : command == "subscribe-host" ? Type::kSubscribeHost
+                                                         : Type::kUnsubscribeHost;
+        VerifyOrExit(fields >> aOperation.mHostName, error = OTBR_ERROR_PARSE);
+
+        while (aOperation.mType == Type::kPublishHost && fields >> field)
+        {
+            Ip6Address address;
+
+            VerifyOrExit(Ip6Address::FromString(field.c_str(), address) == OTBR_ERROR_NONE, error = OTBR_ERROR_PARSE);
+            aOperation.mAddresses.push_back(address);
+        }
+    }
+    else if (command == "publish-service")
+    {
+        aOperation.mType = Type::kPublishService;
+        VerifyOrExit(fields >> aOperation.mHostName >> aOperation.mName >> aOperation.mServiceType >> field,
+                     error = OTBR_ERROR_PARSE);
+
+        if (aOperation.mHostName == "-")
+        {
+            aOperation.mHostName.clear();
+        }
+
+        port = strtoul(field.c_str(), nullptr, 0);
+        VerifyOrExit(port <= UINT16_MAX, error = OTBR_ERROR_PARSE);
+        aOperation.mPort = static_cast<uint16_t>(port);
+
+        while (fields >> field)
+        {
+            size_t separator = field.find('=');
+
+            VerifyOrExit(separator != std::string::npos && separator > 0, error = OTBR_ERROR_PARSE);
+            aOperation.mTxtList.emplace_back(field.substr(0, separator).c_str(), field.c_str() + separator + 1);
+        }
+    }
+    else if (command == "unpublish-service")
+    {
+        aOperation.mType = Type::kUnpublishService;
+        VerifyOrExit(fields >> aOperation.mName >> aOperation.mServiceType, error = OTBR_ERROR_PARSE);
+    }
+    else if (command == "subscribe-service" || command == "unsubscribe-service")
+    {
+        aOperation.mType = command == "subscribe-service" ? Type::kSubscribeService : Type::kUnsubscribeService;
+        VerifyOrExit(fields >> aOperation.mServiceType, error = OTBR_ERROR_PARSE);
+        fields >> aOperation.mName;
+    }
+    else
+    {
+        ExitNow(error = OTBR_ERROR_PARSE);
+    }
+
+    VerifyOrExit(!(fields >> field), error = OTBR_ERROR_PARSE);
+
+exit:
+    return error;
+}
+
+} // namespace Mdns
+
+} // namespace otbr
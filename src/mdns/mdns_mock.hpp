@@ -0,0 +1,331 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the in-process mock mDNS publisher.
+ */
+
+#ifndef OTBR_AGENT_MDNS_MOCK_HPP_
+#define OTBR_AGENT_MDNS_MOCK_HPP_
+
+#include <istream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements an mDNS publisher which works without any mDNS daemon.
+ *
+ * The services and hosts published by this publisher, and the remote ones added with `AddRemoteService()` and
+ * `AddRemoteHost()`, can be discovered by subscribing them. The results are reported after a configurable latency,
+ * and a configurable share of the operations fails, so the users of `Publisher` can be tested and benchmarked
+ * deterministically.
+ *
+ */
+class PublisherMock : public Publisher
+{
+public:
+    /**
+     * This structure represents the behavior of the mock publisher.
+     *
+     */
+    struct Config
+    {
+        Milliseconds mLatency{0};                     ///< The latency of the results, or zero for no latency.
+        uint8_t      mFailureRate  = 0;               ///< The percentage of the operations which fail.
+        otbrError    mFailureError = OTBR_ERROR_MDNS; ///< The error of the failed operations.
+        uint32_t     mSeed         = 1;               ///< The seed for choosing the failed operations.
+    };
+
+    /**
+     * The constructor initializes the mock publisher.
+     *
+     * @param[in] aCallback  The callback for receiving mDNS publisher state changes.
+     * @param[in] aConfig    The behavior of the mock publisher.
+     *
+     */
+    PublisherMock(StateCallback aCallback, const Config &aConfig);
+
+    ~PublisherMock(void) override;
+
+    /**
+     * This method sets the behavior of the mock publisher.
+     *
+     * @param[in] aConfig  The behavior of the mock publisher.
+     *
+     */
+    void SetConfig(const Config &aConfig);
+
+    /**
+     * This method adds a service instance on the simulated network, which can be discovered by subscribing it.
+     *
+     * @param[in] aType          The service type, e.g. "_meshcop._udp".
+     * @param[in] aInstanceInfo  The service instance.
+     *
+     */
+    void AddRemoteService(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+
+    /**
+     * This method adds a host on the simulated network, which can be discovered by subscribing it.
+     *
+     * @param[in] aHostName  The host name (without domain).
+     * @param[in] aHostInfo  The host.
+     *
+     */
+    void AddRemoteHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+
+    // Implementation of Mdns::Publisher.
+
+    otbrError Start(void) override;
+    void      Stop(void) override;
+    bool      IsStarted(void) const override;
+    void      UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
+    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
+    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHost(const std::string &aHostName) override;
+    void      UnsubscribeHost(const std::string &aHostName) override;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtList     &aTxtList,
+                                 ResultCallback   &&aCallback) override;
+    otbrError PublishHostImpl(const std::string             &aName,
+                              const std::vector<Ip6Address> &aAddresses,
+                              ResultCallback               &&aCallback) override;
+    void      OnServiceResolveFailedImpl(const std::string &aType,
+                                         const std::string &aInstanceName,
+                                         int32_t            aErrorCode) override;
+    void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
+    otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+
+private:
+    static constexpr uint32_t kNetifIndex = 1;
+    static constexpr uint32_t kTtl        = 120;
+
+    class MockServiceRegistration : public ServiceRegistration
+    {
+    public:
+        MockServiceRegistration(const std::string &aHostName,
+                                const std::string &aName,
+                                const std::string &aType,
+                                const SubTypeList &aSubTypeList,
+                                uint16_t           aPort,
+                                const TxtList     &aTxtList,
+                                ResultCallback   &&aCallback,
+                                uint64_t           aId,
+                                PublisherMock     *aPublisher)
+            : ServiceRegistration(aHostName,
+                                  aName,
+                                  aType,
+                                  aSubTypeList,
+                                  aPort,
+                                  aTxtList,
+                                  std::move(aCallback),
+                                  aPublisher)
+            , mId(aId)
+        {
+        }
+
+        // Identifies the registration in the delayed results, as a newer registration may reuse the name.
+        uint64_t mId;
+    };
+
+    class MockHostRegistration : public HostRegistration
+    {
+    public:
+        MockHostRegistration(const std::string             &aName,
+                             const std::vector<Ip6Address> &aAddresses,
+                             ResultCallback               &&aCallback,
+                             uint64_t                       aId,
+                             PublisherMock                 *aPublisher)
+            : HostRegistration(aName, aAddresses, std::move(aCallback), aPublisher)
+            , mId(aId)
+        {
+        }
+
+        uint64_t mId;
+    };
+
+    typedef std::pair<std::string, std::string> ServiceKey; // {type, instance name}
+
+    bool ShouldFail(void);
+    void Report(TaskRunner::Task<void> aTask);
+
+    void HandleServiceResult(const std::string &aName, const std::string &aType, uint64_t aId, otbrError aError);
+    void HandleHostResult(const std::string &aName, uint64_t aId, otbrError aError);
+    void ResolveService(const std::string &aType, const std::string &aInstanceName);
+    void ResolveHost(const std::string &aHostName);
+
+    bool IsServiceSubscribed(const std::string &aType, const std::string &aInstanceName) const;
+    bool MakeLocalInstanceInfo(const ServiceRegistration &aServiceReg, DiscoveredInstanceInfo &aInstanceInfo) const;
+
+    StateCallback    mStateCallback;
+    State            mState;
+    Config           mConfig;
+    std::minstd_rand mRandom;
+    TaskRunner       mTaskRunner;
+    uint64_t         mNextRegistrationId;
+
+    std::map<ServiceKey, DiscoveredInstanceInfo> mRemoteServices;
+    std::map<std::string, DiscoveredHostInfo>    mRemoteHosts;
+    std::set<ServiceKey>                         mSubscribedServices;
+    std::set<std::string>                        mSubscribedHosts;
+};
+
+/**
+ * This class replays a trace of mDNS operations on a publisher.
+ *
+ * Each line of the trace is an operation, empty lines and lines starting with '#' are ignored:
+ *
+ *     publish-host <host> <address>...
+ *     unpublish-host <host>
+ *     publish-service <host>|- <instance> <type> <port> [<key>=<value>...]
+ *     unpublish-service <instance> <type>
+ *     subscribe-service <type> [<instance>]
+ *     unsubscribe-service <type> [<instance>]
+ *     subscribe-host <host>
+ *     unsubscribe-host <host>
+ *
+ */
+class PublisherReplayer
+{
+public:
+    /**
+     * This structure represents the counters of a replay.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mOperations = 0; ///< The number of the issued operations.
+        uint64_t mSucceeded  = 0; ///< The number of the operations which completed successfully.
+        uint64_t mFailed     = 0; ///< The number of the operations which failed.
+        uint64_t mInstances  = 0; ///< The number of the discovered service instances.
+        uint64_t mHosts      = 0; ///< The number of the discovered hosts.
+    };
+
+    /**
+     * The constructor initializes the replayer.
+     *
+     * @param[in] aPublisher  The publisher which the operations are replayed on.
+     *
+     */
+    explicit PublisherReplayer(Publisher &aPublisher);
+
+    ~PublisherReplayer(void);
+
+    /**
+     * This method loads a trace, which replaces the loaded one.
+     *
+     * @param[in] aTrace  The trace.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully loaded the trace.
+     * @retval OTBR_ERROR_PARSE  The trace has an invalid line.
+     *
+     */
+    otbrError Load(std::istream &aTrace);
+
+    /**
+     * This method issues all the operations of the loaded trace.
+     *
+     * The results of the operations are counted when they are reported by the publisher.
+     *
+     */
+    void Replay(void);
+
+    /**
+     * This method returns the number of the operations whose results are not reported yet.
+     *
+     * @returns The number of the pending operations.
+     *
+     */
+    uint64_t GetNumPending(void) const { return mCounters.mOperations - mCounters.mSucceeded - mCounters.mFailed; }
+
+    /**
+     * This method returns the counters of all the replays.
+     *
+     * @returns The counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+private:
+    enum class Type
+    {
+        kPublishHost,
+        kUnpublishHost,
+        kPublishService,
+        kUnpublishService,
+        kSubscribeService,
+        kUnsubscribeService,
+        kSubscribeHost,
+        kUnsubscribeHost,
+    };
+
+    struct Operation
+    {
+        Type                   mType;
+        std::string            mHostName;
+        std::string            mName;
+        std::string            mServiceType;
+        uint16_t               mPort = 0;
+        Publisher::TxtList     mTxtList;
+        Publisher::AddressList mAddresses;
+    };
+
+    static otbrError ParseOperation(const std::string &aLine, Operation &aOperation);
+
+    Publisher::ResultCallback MakeResultCallback(void);
+
+    Publisher             &mPublisher;
+    std::vector<Operation> mOperations;
+    Counters               mCounters;
+    uint64_t               mSubscriberId;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_MOCK_HPP_
@@ -67,7 +67,8 @@ ControllerOpenThread::ControllerOpenThread(const char                      *aInt
                                            const char                      *aBackboneInterfaceName,
                                            bool                             aDryRun,
                                            bool                             aEnableAutoAttach)
-    : mInstance(nullptr)
+    : MainloopProcessor(kPriorityHigh)
+    , mInstance(nullptr)
     , mEnableAutoAttach(aEnableAutoAttach)
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
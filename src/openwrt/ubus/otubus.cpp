@@ -36,6 +36,8 @@
 
 #include <mutex>
 
+#include <errno.h>
+
 #include <arpa/inet.h>
 #include <sys/eventfd.h>
 
@@ -58,19 +60,27 @@ const static int PANID_LENGTH      = 10;
 const static int XPANID_LENGTH     = 64;
 const static int NETWORKKEY_LENGTH = 64;
 
-UbusServer::UbusServer(Ncp::ControllerOpenThread *aController, std::mutex *aMutex)
-    : mIfFinishScan(false)
-    , mContext(nullptr)
+UbusServer::UbusServer(Ncp::ControllerOpenThread *aController, std::mutex *aMutex, TaskRunner *aTaskRunner)
+    : mContext(nullptr)
     , mSockPath(nullptr)
     , mController(aController)
     , mNcpThreadMutex(aMutex)
+    , mMainloopTaskRunner(aTaskRunner)
     , mSecond(0)
+    , mScanning(false)
+    , mScanList(nullptr)
 {
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mUbusTaskFd, 0, sizeof(mUbusTaskFd));
 
     blob_buf_init(&mBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
+
+    mUbusTaskFd.cb = &UbusServer::HandleUbusTasks;
+    mUbusTaskFd.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -78,9 +88,55 @@ UbusServer &UbusServer::GetInstance(void)
     return *sUbusServerInstance;
 }
 
-void UbusServer::Initialize(Ncp::ControllerOpenThread *aController, std::mutex *aMutex)
+void UbusServer::Initialize(Ncp::ControllerOpenThread *aController, std::mutex *aMutex, TaskRunner *aTaskRunner)
+{
+    sUbusServerInstance = new UbusServer(aController, aMutex, aTaskRunner);
+}
+
+void UbusServer::PostUbusTask(std::function<void()> aTask)
+{
+    uint64_t eventNum = 1;
+
+    {
+        std::lock_guard<std::mutex> _(mUbusTaskMutex);
+
+        mUbusTasks.push_back(std::move(aTask));
+    }
+
+    if (write(mUbusTaskFd.fd, &eventNum, sizeof(eventNum)) != sizeof(eventNum) && errno != EAGAIN)
+    {
+        otbrLogWarning("Failed to wake up the ubus thread: %s", strerror(errno));
+    }
+}
+
+void UbusServer::HandleUbusTasks(struct uloop_fd *aFd, unsigned int aEvents)
 {
-    sUbusServerInstance = new UbusServer(aController, aMutex);
+    OT_UNUSED_VARIABLE(aFd);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    GetInstance().ProcessUbusTasks();
+}
+
+void UbusServer::ProcessUbusTasks(void)
+{
+    uint64_t                           eventNum;
+    ssize_t                            retval;
+    std::vector<std::function<void()>> tasks;
+
+    // Clears the eventfd before taking the tasks, so that a task posted afterwards wakes up uloop again.
+    retval = read(mUbusTaskFd.fd, &eventNum, sizeof(eventNum));
+    OT_UNUSED_VARIABLE(retval);
+
+    {
+        std::lock_guard<std::mutex> _(mUbusTaskMutex);
+
+        tasks.swap(mUbusTasks);
+    }
+
+    for (std::function<void()> &task : tasks)
+    {
+        task();
+    }
 }
 
 enum
@@ -229,12 +285,18 @@ void UbusServer::ProcessScan(void)
     uint32_t scanChannels = 0;
     uint16_t scanDuration = 0;
 
-    mNcpThreadMutex->lock();
+    blob_buf_init(&mScanBuf, 0);
+    mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
+
     SuccessOrExit(error = otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration,
                                            &UbusServer::HandleActiveScanResult, this));
+
 exit:
-    mNcpThreadMutex->unlock();
-    return;
+    if (error != OT_ERROR_NONE)
+    {
+        blobmsg_close_array(&mScanBuf, mScanList);
+        PostUbusTask([this, error]() { HandleScanDone(error); });
+    }
 }
 
 void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
@@ -267,33 +329,48 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
-        mIfFinishScan = true;
+        blobmsg_close_array(&mScanBuf, mScanList);
+        PostUbusTask([this]() { HandleScanDone(OT_ERROR_NONE); });
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
 
     sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_string(&mScanBuf, "PanId", panidstring);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
 
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_close_table(&mScanBuf, jsonList);
 
 exit:
     return;
 }
 
+void UbusServer::HandleScanDone(otError aError)
+{
+    // The mainloop thread doesn't touch the scan result any more until the next scan is posted.
+    blobmsg_add_u16(&mScanBuf, "Error", aError);
+
+    for (struct ubus_request_data &request : mScanRequests)
+    {
+        ubus_send_reply(mContext, &request, mScanBuf.head);
+        ubus_complete_deferred_request(mContext, &request, UBUS_STATUS_OK);
+    }
+
+    mScanRequests.clear();
+    mScanning = false;
+}
+
 int UbusServer::UbusScanHandler(struct ubus_context      *aContext,
                                 struct ubus_object       *aObj,
                                 struct ubus_request_data *aRequest,
@@ -313,31 +390,19 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context      *aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    struct ubus_request_data deferred;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    // Replies the request when the scan is done, so the ubus thread keeps serving other requests meanwhile. The
+    // requests received during a scan share its result.
+    ubus_defer_request(aContext, aRequest, &deferred);
+    mScanRequests.push_back(deferred);
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
-
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
+    if (!mScanning)
     {
-        error = OT_ERROR_FAILED;
-        goto exit;
+        mScanning = true;
+        mMainloopTaskRunner->Post([this]() { ProcessScan(); });
     }
 
-    while (!mIfFinishScan)
-    {
-        sleep(1);
-    }
-
-exit:
-    AppendResult(error, aContext, aRequest);
     return 0;
 }
 
@@ -1738,6 +1803,12 @@ void UbusServer::InstallUbusObject(void)
         return;
     }
 
+    if (mUbusTaskFd.fd == -1 || uloop_fd_add(&mUbusTaskFd, ULOOP_READ) != 0)
+    {
+        otbrLogErr("Failed to watch the ubus task eventfd");
+        return;
+    }
+
     otbrLogInfo("Uloop run");
     uloop_run();
 
@@ -1808,7 +1879,7 @@ void UBusAgent::Init(void)
 {
     otbr::ubus::sUbusEfd = eventfd(0, 0);
 
-    otbr::ubus::UbusServer::Initialize(&mNcp, &mThreadMutex);
+    otbr::ubus::UbusServer::Initialize(&mNcp, &mThreadMutex, &mTaskRunner);
 
     if (otbr::ubus::sUbusEfd == -1)
     {
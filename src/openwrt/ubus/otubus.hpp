@@ -36,6 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <functional>
+#include <mutex>
+#include <vector>
+
 #include <stdarg.h>
 #include <time.h>
 
@@ -46,6 +50,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 extern "C" {
@@ -79,8 +84,9 @@ public:
      *
      * @param[in] aController  A pointer to OpenThread Controller structure.
      * @param[in] aMutex       A pointer to mutex.
+     * @param[in] aTaskRunner  A pointer to the task runner which runs tasks on the mainloop.
      */
-    static void Initialize(Ncp::ControllerOpenThread *aController, std::mutex *aMutex);
+    static void Initialize(Ncp::ControllerOpenThread *aController, std::mutex *aMutex, TaskRunner *aTaskRunner);
 
     /**
      * This method return the instance of the global UbusServer.
@@ -787,14 +793,28 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                       mIfFinishScan;
     struct ubus_context       *mContext;
     const char                *mSockPath;
     struct blob_buf            mBuf;
     struct blob_buf            mNetworkdataBuf;
     Ncp::ControllerOpenThread *mController;
     std::mutex                *mNcpThreadMutex;
+    TaskRunner                *mMainloopTaskRunner;
     time_t                     mSecond;
+
+    // The scan requests waiting for the result, which are only accessed in the ubus thread.
+    std::vector<struct ubus_request_data> mScanRequests;
+    bool                                  mScanning;
+
+    // The scan result, which is only accessed in the mainloop thread until the scan is done.
+    struct blob_buf mScanBuf;
+    void           *mScanList;
+
+    // The tasks posted to the ubus thread.
+    std::mutex                         mUbusTaskMutex;
+    std::vector<std::function<void()>> mUbusTasks;
+    struct uloop_fd                    mUbusTaskFd;
+
     enum
     {
         kDefaultJoinerTimeout = 120,
@@ -806,14 +826,47 @@ private:
      * @param[in] aController  The pointer to OpenThread Controller structure.
      * @param[in] aMutex       A pointer to mutex.
      */
-    UbusServer(Ncp::ControllerOpenThread *aController, std::mutex *aMutex);
+    UbusServer(Ncp::ControllerOpenThread *aController, std::mutex *aMutex, TaskRunner *aTaskRunner);
 
     /**
-     * This method start scan.
+     * This method posts a task to run in the ubus thread.
+     *
+     * This method can be called from any thread.
+     *
+     * @param[in] aTask  The task to run.
+     *
+     */
+    void PostUbusTask(std::function<void()> aTask);
+
+    /**
+     * This method handles the event of the ubus task eventfd (callback function).
+     *
+     * @param[in] aFd      A pointer to the uloop fd.
+     * @param[in] aEvents  The uloop events.
+     *
+     */
+    static void HandleUbusTasks(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method runs the tasks posted to the ubus thread.
+     *
+     */
+    void ProcessUbusTasks(void);
+
+    /**
+     * This method starts scan in the mainloop thread.
      *
      */
     void ProcessScan(void);
 
+    /**
+     * This method replies all the waiting scan requests in the ubus thread.
+     *
+     * @param[in] aError  The error of the scan.
+     *
+     */
+    void HandleScanDone(otError aError);
+
     /**
      * This method detailly start scan.
      *
@@ -1155,6 +1208,7 @@ public:
     UBusAgent(otbr::Ncp::ControllerOpenThread &aNcp)
         : mNcp(aNcp)
         , mThreadMutex()
+        , mTaskRunner()
     {
     }
 
@@ -1172,6 +1226,7 @@ private:
 
     otbr::Ncp::ControllerOpenThread &mNcp;
     std::mutex                       mThreadMutex;
+    TaskRunner                       mTaskRunner;
 };
 } // namespace ubus
 } // namespace otbr
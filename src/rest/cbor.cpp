@@ -0,0 +1,464 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/cbor.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+namespace Cbor {
+
+// The tag of an IPv6 address (RFC 9164).
+static constexpr uint64_t kTagIp6Address = 54;
+
+void Writer::WriteHead(uint8_t aMajorType, uint64_t aValue)
+{
+    uint8_t length;
+
+    if (aValue < 24)
+    {
+        mBuffer.push_back(static_cast<char>(aMajorType | aValue));
+        ExitNow();
+    }
+
+    if (aValue <= UINT8_MAX)
+    {
+        mBuffer.push_back(static_cast<char>(aMajorType | 24));
+        length = 1;
+    }
+    else if (aValue <= UINT16_MAX)
+    {
+        mBuffer.push_back(static_cast<char>(aMajorType | 25));
+        length = 2;
+    }
+    else if (aValue <= UINT32_MAX)
+    {
+        mBuffer.push_back(static_cast<char>(aMajorType | 26));
+        length = 4;
+    }
+    else
+    {
+        mBuffer.push_back(static_cast<char>(aMajorType | 27));
+        length = 8;
+    }
+
+    // The argument is in network byte order.
+    while (length > 0)
+    {
+        --length;
+        mBuffer.push_back(static_cast<char>((aValue >> (8 * length)) & 0xff));
+    }
+
+exit:
+    return;
+}
+
+void Writer::WriteInt(int64_t aValue)
+{
+    if (aValue < 0)
+    {
+        // A negative integer n is encoded as -1 - n.
+        WriteHead(kMajorTypeNegativeInt, static_cast<uint64_t>(-(aValue + 1)));
+    }
+    else
+    {
+        WriteHead(kMajorTypeUint, static_cast<uint64_t>(aValue));
+    }
+}
+
+void Writer::WriteBytes(const uint8_t *aBytes, size_t aLength)
+{
+    WriteHead(kMajorTypeBytes, aLength);
+    mBuffer.append(reinterpret_cast<const char *>(aBytes), aLength);
+}
+
+void Writer::WriteText(StringView aText)
+{
+    WriteHead(kMajorTypeText, aText.size());
+    mBuffer.append(aText.data(), aText.size());
+}
+
+static void WriteIpAddr(Writer &aWriter, const otIp6Address &aAddress)
+{
+    aWriter.WriteTag(kTagIp6Address);
+    aWriter.WriteBytes(aAddress.mFields.m8, sizeof(aAddress.mFields.m8));
+}
+
+static void WriteMode(Writer &aWriter, const otLinkModeConfig &aMode)
+{
+    aWriter.StartMap(3);
+    aWriter.WriteText("RxOnWhenIdle");
+    aWriter.WriteUint(aMode.mRxOnWhenIdle);
+    aWriter.WriteText("DeviceType");
+    aWriter.WriteUint(aMode.mDeviceType);
+    aWriter.WriteText("NetworkData");
+    aWriter.WriteUint(aMode.mNetworkData);
+}
+
+static void WriteLeaderData(Writer &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.StartMap(5);
+    aWriter.WriteText("PartitionId");
+    aWriter.WriteUint(aLeaderData.mPartitionId);
+    aWriter.WriteText("Weighting");
+    aWriter.WriteUint(aLeaderData.mWeighting);
+    aWriter.WriteText("DataVersion");
+    aWriter.WriteUint(aLeaderData.mDataVersion);
+    aWriter.WriteText("StableDataVersion");
+    aWriter.WriteUint(aLeaderData.mStableDataVersion);
+    aWriter.WriteText("LeaderRouterId");
+    aWriter.WriteUint(aLeaderData.mLeaderRouterId);
+}
+
+static void WriteChildTableEntry(Writer &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.StartMap(3);
+    aWriter.WriteText("ChildId");
+    aWriter.WriteUint(aChildEntry.mChildId);
+    aWriter.WriteText("Timeout");
+    aWriter.WriteUint(aChildEntry.mTimeout);
+    aWriter.WriteText("Mode");
+    WriteMode(aWriter, aChildEntry.mMode);
+}
+
+static void WriteMacCounters(Writer &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.StartMap(9);
+    aWriter.WriteText("IfInUnknownProtos");
+    aWriter.WriteUint(aMacCounters.mIfInUnknownProtos);
+    aWriter.WriteText("IfInErrors");
+    aWriter.WriteUint(aMacCounters.mIfInErrors);
+    aWriter.WriteText("IfOutErrors");
+    aWriter.WriteUint(aMacCounters.mIfOutErrors);
+    aWriter.WriteText("IfInUcastPkts");
+    aWriter.WriteUint(aMacCounters.mIfInUcastPkts);
+    aWriter.WriteText("IfInBroadcastPkts");
+    aWriter.WriteUint(aMacCounters.mIfInBroadcastPkts);
+    aWriter.WriteText("IfInDiscards");
+    aWriter.WriteUint(aMacCounters.mIfInDiscards);
+    aWriter.WriteText("IfOutUcastPkts");
+    aWriter.WriteUint(aMacCounters.mIfOutUcastPkts);
+    aWriter.WriteText("IfOutBroadcastPkts");
+    aWriter.WriteUint(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.WriteText("IfOutDiscards");
+    aWriter.WriteUint(aMacCounters.mIfOutDiscards);
+}
+
+static void WriteConnectivity(Writer &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.StartMap(9);
+    aWriter.WriteText("ParentPriority");
+    aWriter.WriteInt(aConnectivity.mParentPriority);
+    aWriter.WriteText("LinkQuality3");
+    aWriter.WriteUint(aConnectivity.mLinkQuality3);
+    aWriter.WriteText("LinkQuality2");
+    aWriter.WriteUint(aConnectivity.mLinkQuality2);
+    aWriter.WriteText("LinkQuality1");
+    aWriter.WriteUint(aConnectivity.mLinkQuality1);
+    aWriter.WriteText("LeaderCost");
+    aWriter.WriteUint(aConnectivity.mLeaderCost);
+    aWriter.WriteText("IdSequence");
+    aWriter.WriteUint(aConnectivity.mIdSequence);
+    aWriter.WriteText("ActiveRouters");
+    aWriter.WriteUint(aConnectivity.mActiveRouters);
+    aWriter.WriteText("SedBufferSize");
+    aWriter.WriteUint(aConnectivity.mSedBufferSize);
+    aWriter.WriteText("SedDatagramCount");
+    aWriter.WriteUint(aConnectivity.mSedDatagramCount);
+}
+
+static void WriteRoute(Writer &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.StartMap(2);
+    aWriter.WriteText("IdSequence");
+    aWriter.WriteUint(aRoute.mIdSequence);
+    aWriter.WriteText("RouteData");
+    aWriter.StartArray(aRoute.mRouteCount);
+
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        const otNetworkDiagRouteData &routeData = aRoute.mRouteData[i];
+
+        aWriter.StartMap(4);
+        aWriter.WriteText("RouteId");
+        aWriter.WriteUint(routeData.mRouterId);
+        aWriter.WriteText("LinkQualityOut");
+        aWriter.WriteUint(routeData.mLinkQualityOut);
+        aWriter.WriteText("LinkQualityIn");
+        aWriter.WriteUint(routeData.mLinkQualityIn);
+        aWriter.WriteText("RouteCost");
+        aWriter.WriteUint(routeData.mRouteCost);
+    }
+}
+
+static void WriteNodeDiag(Writer &aWriter, const std::vector<otNetworkDiagTlv> &aDiag)
+{
+    // The number of the known TLVs is not counted beforehand, so the map is ended by a break.
+    aWriter.StartIndefiniteMap();
+
+    for (const otNetworkDiagTlv &diagTlv : aDiag)
+    {
+        switch (diagTlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+            aWriter.WriteText("ExtAddress");
+            aWriter.WriteBytes(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            aWriter.WriteText("Rloc16");
+            aWriter.WriteUint(diagTlv.mData.mAddr16);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            aWriter.WriteText("Mode");
+            WriteMode(aWriter, diagTlv.mData.mMode);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+            aWriter.WriteText("Timeout");
+            aWriter.WriteUint(diagTlv.mData.mTimeout);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            aWriter.WriteText("Connectivity");
+            WriteConnectivity(aWriter, diagTlv.mData.mConnectivity);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            aWriter.WriteText("Route");
+            WriteRoute(aWriter, diagTlv.mData.mRoute);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+            aWriter.WriteText("LeaderData");
+            WriteLeaderData(aWriter, diagTlv.mData.mLeaderData);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+            aWriter.WriteText("NetworkData");
+            aWriter.WriteBytes(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+            aWriter.WriteText("IP6AddressList");
+            aWriter.StartArray(diagTlv.mData.mIp6AddrList.mCount);
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                WriteIpAddr(aWriter, diagTlv.mData.mIp6AddrList.mList[i]);
+            }
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            aWriter.WriteText("MACCounters");
+            WriteMacCounters(aWriter, diagTlv.mData.mMacCounters);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+            aWriter.WriteText("BatteryLevel");
+            aWriter.WriteUint(diagTlv.mData.mBatteryLevel);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            aWriter.WriteText("SupplyVoltage");
+            aWriter.WriteUint(diagTlv.mData.mSupplyVoltage);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            aWriter.WriteText("ChildTable");
+            aWriter.StartArray(diagTlv.mData.mChildTable.mCount);
+            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+            {
+                WriteChildTableEntry(aWriter, diagTlv.mData.mChildTable.mTable[i]);
+            }
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+            aWriter.WriteText("ChannelPages");
+            aWriter.WriteBytes(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+            aWriter.WriteText("MaxChildTimeout");
+            aWriter.WriteUint(diagTlv.mData.mMaxChildTimeout);
+            break;
+        default:
+            break;
+        }
+    }
+
+    aWriter.EndIndefinite();
+}
+
+void Number2Cbor(uint32_t aNumber, std::string &aBuffer)
+{
+    Writer(aBuffer).WriteUint(aNumber);
+}
+
+void Bytes2Cbor(const uint8_t *aBytes, uint8_t aLength, std::string &aBuffer)
+{
+    Writer(aBuffer).WriteBytes(aBytes, aLength);
+}
+
+void String2Cbor(StringView aString, std::string &aBuffer)
+{
+    Writer(aBuffer).WriteText(aString);
+}
+
+void IpAddr2Cbor(const otIp6Address &aAddress, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    WriteIpAddr(writer, aAddress);
+}
+
+void LeaderData2Cbor(const otLeaderData &aLeaderData, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    WriteLeaderData(writer, aLeaderData);
+}
+
+void Node2Cbor(const NodeInfo &aNode, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    writer.StartMap(8);
+    writer.WriteText("State");
+    writer.WriteUint(aNode.mRole);
+    writer.WriteText("NumOfRouter");
+    writer.WriteUint(aNode.mNumOfRouter);
+    writer.WriteText("RlocAddress");
+    WriteIpAddr(writer, aNode.mRlocAddress);
+    writer.WriteText("ExtAddress");
+    writer.WriteBytes(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    writer.WriteText("NetworkName");
+    writer.WriteText(aNode.mNetworkName);
+    writer.WriteText("Rloc16");
+    writer.WriteUint(aNode.mRloc16);
+    writer.WriteText("LeaderData");
+    WriteLeaderData(writer, aNode.mLeaderData);
+    writer.WriteText("ExtPanId");
+    writer.WriteBytes(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+}
+
+void Diag2Cbor(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    writer.StartArray(aDiagSet.size());
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        WriteNodeDiag(writer, diagItem);
+    }
+}
+
+void NodeDiag2Cbor(const std::vector<otNetworkDiagTlv> &aDiag, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    WriteNodeDiag(writer, aDiag);
+}
+
+void Topology2Cbor(const agent::TopologyModel::Snapshot &aTopology, std::string &aBuffer)
+{
+    Writer    writer(aBuffer);
+    Timepoint now = Clock::now();
+
+    writer.StartMap(3);
+    writer.WriteText("Version");
+    writer.WriteUint(aTopology.mVersion);
+    writer.WriteText("RefreshInterval");
+    writer.WriteUint(static_cast<uint64_t>(aTopology.mRefreshInterval.count()));
+    writer.WriteText("Nodes");
+    writer.StartArray(aTopology.mNodes.size());
+
+    for (const auto &entry : aTopology.mNodes)
+    {
+        const agent::TopologyModel::Node &node = entry.second;
+
+        writer.StartMap(6);
+        writer.WriteText("Rloc16");
+        writer.WriteUint(node.mRloc16);
+        writer.WriteText("ExtAddress");
+        writer.WriteBytes(node.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        writer.WriteText("Mode");
+        WriteMode(writer, node.mMode);
+        writer.WriteText("Age");
+        writer.WriteUint(static_cast<uint64_t>(std::chrono::duration_cast<Seconds>(now - node.mUpdateTime).count()));
+
+        writer.WriteText("Routes");
+        writer.StartArray(node.mRoutes.size());
+        for (const agent::TopologyModel::Route &route : node.mRoutes)
+        {
+            writer.StartMap(4);
+            writer.WriteText("RouterRloc16");
+            writer.WriteUint(route.mRouterRloc16);
+            writer.WriteText("LinkQualityIn");
+            writer.WriteUint(route.mLinkQualityIn);
+            writer.WriteText("LinkQualityOut");
+            writer.WriteUint(route.mLinkQualityOut);
+            writer.WriteText("RouteCost");
+            writer.WriteUint(route.mRouteCost);
+        }
+
+        writer.WriteText("Children");
+        writer.StartArray(node.mChildren.size());
+        for (const agent::TopologyModel::Child &child : node.mChildren)
+        {
+            writer.StartMap(3);
+            writer.WriteText("Rloc16");
+            writer.WriteUint(child.mRloc16);
+            writer.WriteText("Timeout");
+            writer.WriteUint(child.mTimeout);
+            writer.WriteText("Mode");
+            WriteMode(writer, child.mMode);
+        }
+    }
+}
+
+void BatchResults2Cbor(const std::vector<BatchResult> &aResults, std::string &aBuffer)
+{
+    Writer writer(aBuffer);
+
+    writer.StartArray(aResults.size());
+    for (const BatchResult &result : aResults)
+    {
+        writer.StartMap(3);
+        writer.WriteText("Path");
+        writer.WriteText(result.mPath);
+        writer.WriteText("Status");
+        writer.WriteUint(result.mStatus);
+        writer.WriteText("Body");
+
+        if (result.mBody.empty())
+        {
+            writer.WriteNull();
+        }
+        else if (result.mContentFormat == ContentFormat::kCbor)
+        {
+            writer.WriteEncoded(result.mBody);
+        }
+        else
+        {
+            writer.WriteText(result.mBody);
+        }
+    }
+}
+
+} // namespace Cbor
+} // namespace rest
+} // namespace otbr
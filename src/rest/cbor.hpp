@@ -0,0 +1,285 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes CBOR formatter definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_CBOR_HPP_
+#define OTBR_REST_CBOR_HPP_
+
+#include <string>
+#include <vector>
+
+#include "openthread/link.h"
+#include "openthread/thread_ftd.h"
+
+#include "common/string_view.hpp"
+#include "rest/types.hpp"
+#include "utils/topology_model.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The functions within this namespace encode the REST resources as CBOR (RFC 8949), with the same structure as the
+ * JSON representation except that byte arrays are byte strings and IPv6 addresses are tagged byte strings (RFC 9164).
+ *
+ * The encoders append to a buffer, so that a response body could be written in place.
+ *
+ */
+namespace Cbor {
+
+/**
+ * This class implements a streaming CBOR encoder.
+ *
+ */
+class Writer
+{
+public:
+    /**
+     * The constructor initializes a writer which appends to a buffer.
+     *
+     * @param[in] aBuffer  A reference to the buffer.
+     *
+     */
+    explicit Writer(std::string &aBuffer)
+        : mBuffer(aBuffer)
+    {
+    }
+
+    /**
+     * This method writes an unsigned integer.
+     *
+     * @param[in] aValue  The unsigned integer.
+     *
+     */
+    void WriteUint(uint64_t aValue) { WriteHead(kMajorTypeUint, aValue); }
+
+    /**
+     * This method writes a signed integer.
+     *
+     * @param[in] aValue  The signed integer.
+     *
+     */
+    void WriteInt(int64_t aValue);
+
+    /**
+     * This method writes a byte string.
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     */
+    void WriteBytes(const uint8_t *aBytes, size_t aLength);
+
+    /**
+     * This method writes a text string.
+     *
+     * @param[in] aText  The UTF-8 text.
+     *
+     */
+    void WriteText(StringView aText);
+
+    /**
+     * This method writes a tag, which applies to the next item.
+     *
+     * @param[in] aTag  The tag number.
+     *
+     */
+    void WriteTag(uint64_t aTag) { WriteHead(kMajorTypeTag, aTag); }
+
+    /**
+     * This method writes a boolean.
+     *
+     * @param[in] aValue  The boolean.
+     *
+     */
+    void WriteBool(bool aValue) { mBuffer.push_back(static_cast<char>(aValue ? kSimpleTrue : kSimpleFalse)); }
+
+    /**
+     * This method writes a null.
+     *
+     */
+    void WriteNull(void) { mBuffer.push_back(static_cast<char>(kSimpleNull)); }
+
+    /**
+     * This method writes a data item which is already encoded.
+     *
+     * @param[in] aItem  The encoded data item.
+     *
+     */
+    void WriteEncoded(const std::string &aItem) { mBuffer.append(aItem); }
+
+    /**
+     * This method starts an array of a known number of items.
+     *
+     * @param[in] aCount  The number of items.
+     *
+     */
+    void StartArray(size_t aCount) { WriteHead(kMajorTypeArray, aCount); }
+
+    /**
+     * This method starts a map of a known number of key-value pairs.
+     *
+     * @param[in] aCount  The number of key-value pairs.
+     *
+     */
+    void StartMap(size_t aCount) { WriteHead(kMajorTypeMap, aCount); }
+
+    /**
+     * This method starts a map whose key-value pairs are ended by `EndIndefinite()`.
+     *
+     */
+    void StartIndefiniteMap(void) { mBuffer.push_back(static_cast<char>(kMajorTypeMap | kIndefiniteLength)); }
+
+    /**
+     * This method ends an indefinite-length item.
+     *
+     */
+    void EndIndefinite(void) { mBuffer.push_back(static_cast<char>(kBreak)); }
+
+private:
+    static constexpr uint8_t kMajorTypeUint        = 0 << 5;
+    static constexpr uint8_t kMajorTypeNegativeInt = 1 << 5;
+    static constexpr uint8_t kMajorTypeBytes       = 2 << 5;
+    static constexpr uint8_t kMajorTypeText        = 3 << 5;
+    static constexpr uint8_t kMajorTypeArray       = 4 << 5;
+    static constexpr uint8_t kMajorTypeMap         = 5 << 5;
+    static constexpr uint8_t kMajorTypeTag         = 6 << 5;
+    static constexpr uint8_t kSimpleFalse          = (7 << 5) | 20;
+    static constexpr uint8_t kSimpleTrue           = (7 << 5) | 21;
+    static constexpr uint8_t kSimpleNull           = (7 << 5) | 22;
+    static constexpr uint8_t kIndefiniteLength     = 31;
+    static constexpr uint8_t kBreak                = 0xff;
+
+    void WriteHead(uint8_t aMajorType, uint64_t aValue);
+
+    std::string &mBuffer;
+};
+
+/**
+ * This method encodes an unsigned integer.
+ *
+ * @param[in]  aNumber  The unsigned integer.
+ * @param[out] aBuffer  The buffer to append to.
+ *
+ */
+void Number2Cbor(uint32_t aNumber, std::string &aBuffer);
+
+/**
+ * This method encodes a byte array as a byte string.
+ *
+ * @param[in]  aBytes   A pointer to the bytes.
+ * @param[in]  aLength  The number of bytes.
+ * @param[out] aBuffer  The buffer to append to.
+ *
+ */
+void Bytes2Cbor(const uint8_t *aBytes, uint8_t aLength, std::string &aBuffer);
+
+/**
+ * This method encodes a string as a text string.
+ *
+ * @param[in]  aString  The string.
+ * @param[out] aBuffer  The buffer to append to.
+ *
+ */
+void String2Cbor(StringView aString, std::string &aBuffer);
+
+/**
+ * This method encodes an IPv6 address.
+ *
+ * @param[in]  aAddress  The IPv6 address.
+ * @param[out] aBuffer   The buffer to append to.
+ *
+ */
+void IpAddr2Cbor(const otIp6Address &aAddress, std::string &aBuffer);
+
+/**
+ * This method encodes the leader data.
+ *
+ * @param[in]  aLeaderData  The leader data.
+ * @param[out] aBuffer      The buffer to append to.
+ *
+ */
+void LeaderData2Cbor(const otLeaderData &aLeaderData, std::string &aBuffer);
+
+/**
+ * This method encodes the information of a node.
+ *
+ * @param[in]  aNode    The information of the node.
+ * @param[out] aBuffer  The buffer to append to.
+ *
+ */
+void Node2Cbor(const NodeInfo &aNode, std::string &aBuffer);
+
+/**
+ * This method encodes the diagnostics of a set of nodes.
+ *
+ * @param[in]  aDiagSet  The diagnostics of each node.
+ * @param[out] aBuffer   The buffer to append to.
+ *
+ */
+void Diag2Cbor(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, std::string &aBuffer);
+
+/**
+ * This method encodes the diagnostics of a node.
+ *
+ * @param[in]  aDiag    The diagnostic TLVs of the node.
+ * @param[out] aBuffer  The buffer to append to.
+ *
+ */
+void NodeDiag2Cbor(const std::vector<otNetworkDiagTlv> &aDiag, std::string &aBuffer);
+
+/**
+ * This method encodes the topology of the Thread network.
+ *
+ * @param[in]  aTopology  A snapshot of the topology model.
+ * @param[out] aBuffer    The buffer to append to.
+ *
+ */
+void Topology2Cbor(const agent::TopologyModel::Snapshot &aTopology, std::string &aBuffer);
+
+/**
+ * This method encodes the results of a batch request.
+ *
+ * The CBOR bodies are embedded as is, and the bodies in other formats (the errors) as text strings.
+ *
+ * @param[in]  aResults  The results of the batch operations.
+ * @param[out] aBuffer   The buffer to append to.
+ *
+ */
+void BatchResults2Cbor(const std::vector<BatchResult> &aResults, std::string &aBuffer);
+
+} // namespace Cbor
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CBOR_HPP_
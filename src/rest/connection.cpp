@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define OTBR_LOG_TAG "REST"
+
 #include "rest/connection.hpp"
 
 #include <cerrno>
@@ -35,30 +37,34 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 
-using std::chrono::duration_cast;
+#include "common/logging.hpp"
+
 using std::chrono::microseconds;
-using std::chrono::seconds;
 using std::chrono::steady_clock;
 
 namespace otbr {
 namespace rest {
 
-// The timeout (in microseconds) since a connection is in wait callback state
-static const uint32_t kCallbackTimeout = 10000000;
+// The timeout since a connection is in wait callback state
+static const microseconds kCallbackTimeout(10000000);
 
-// The time interval (in microseconds) for checking again if there is a connection need callback.
-static const uint32_t kCallbackCheckInterval = 500000;
+// The time interval for checking again if there is a connection need callback.
+static const microseconds kCallbackCheckInterval(500000);
 
-// The timeout (in microseconds) since a connection is in wait write state
-static const uint32_t kWriteTimeout = 10000000;
+// The timeout since a connection is in wait write state
+static const microseconds kWriteTimeout(10000000);
 
-// The timeout (in microseconds) since a connection is in wait read state
-static const uint32_t kReadTimeout = 1000000;
+// The timeout since a connection is in wait read state
+static const microseconds kReadTimeout(1000000);
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
-    : mTimeStamp(aStartTime)
-    , mFd(aFd)
-    , mState(ConnectionState::kInit)
+// The maximum size of the events which are not written to a persistent stream yet
+static const size_t kMaxPendingStreamSize = 8192;
+
+Connection::Connection(Resource *aResource)
+    : mPrev(nullptr)
+    , mNext(nullptr)
+    , mFd(-1)
+    , mState(ConnectionState::kComplete)
     , mParser(&mRequest)
     , mResource(aResource)
 {
@@ -69,9 +75,16 @@ Connection::~Connection(void)
     Disconnect();
 }
 
-void Connection::Init(void)
+void Connection::Init(int aFd, steady_clock::time_point aNow)
 {
+    mTimeStamp = aNow;
+    mFd        = aFd;
+    mState     = ConnectionState::kInit;
+    mResponse  = Response();
+    mRequest.Reset();
+    mWriteContent.clear();
     mParser.Init();
+    UpdateDeadline(aNow);
 }
 
 void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
@@ -85,59 +98,45 @@ void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
 
 void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
 {
-    if (mState == ConnectionState::kWriteWait)
+    if (mState == ConnectionState::kWriteWait || (mState == ConnectionState::kCallbackWait && !mWriteContent.empty()))
     {
         FD_SET(mFd, &aWriteFdSet);
         aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
     }
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+void Connection::UpdateDeadline(steady_clock::time_point aNow)
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
-
     switch (mState)
     {
+    case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
+        mDeadline = mTimeStamp + kReadTimeout;
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        // Check the callback periodically instead of busy polling.
+        mDeadline = aNow + kCallbackCheckInterval;
         break;
     case ConnectionState::kWriteWait:
-        timeoutLen = kWriteTimeout;
-        break;
-    case ConnectionState::kComplete:
-        timeoutLen = 0;
+        mDeadline = mTimeStamp + kWriteTimeout;
         break;
     default:
+        mDeadline = aNow;
         break;
     }
-
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
-
-    if (timercmp(&timeout, &aTimeout, <))
-    {
-        aTimeout = timeout;
-    }
 }
 
-void Connection::Update(MainloopContext &aMainloop)
+void Connection::Update(MainloopContext &aMainloop) const
 {
-    UpdateTimeout(aMainloop.mTimeout);
     UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
     UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+
+    // The deferred body is filled by a task after this connection was processed, so write it without waiting for
+    // the next callback check.
+    if (mState == ConnectionState::kCallbackWait && mResponse.IsDeferredBodyReady())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
 }
 
 void Connection::Disconnect(void)
@@ -151,43 +150,37 @@ void Connection::Disconnect(void)
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::Process(const MainloopContext &aMainloop, steady_clock::time_point aNow)
 {
-    otbrError error = OTBR_ERROR_NONE;
-
     switch (mState)
     {
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        ProcessWaitRead(aMainloop.mReadFdSet, aNow);
         break;
     case ConnectionState::kCallbackWait:
         //  Wait for Callback process.
-        ProcessWaitCallback();
+        ProcessWaitCallback(aNow);
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(aMainloop.mWriteFdSet, aNow);
         break;
     default:
         assert(false);
     }
 
-    if (error != OTBR_ERROR_NONE)
-    {
-        Disconnect();
-    }
+    UpdateDeadline(aNow);
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(const fd_set &aReadFdSet, steady_clock::time_point aNow)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
     char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    VerifyOrExit(aNow <= mDeadline, error = OTBR_ERROR_REST);
 
     // It will succeed either fd is set or it is in kInit state.
     VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
@@ -205,7 +198,7 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
 
     if (mRequest.IsComplete())
     {
-        Handle();
+        Handle(aNow);
     }
 
     // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
@@ -222,17 +215,17 @@ exit:
         if (received < 0)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
+            Write(aNow);
         }
         else
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusRequestTimeout);
-            Write();
+            Write(aNow);
         }
     }
 }
 
-void Connection::Handle(void)
+void Connection::Handle(steady_clock::time_point aNow)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -240,17 +233,19 @@ void Connection::Handle(void)
     // socket.
     VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
 
+    // The connection waits for the callback of a deferred body, which a nested response in a batch cannot do.
+    mResponse.SetDeferrable();
     mResource->Handle(mRequest, mResponse);
 
     if (mResponse.NeedCallback())
     {
         mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mTimeStamp = aNow;
     }
     else
     {
         // Normal Write back process.
-        Write();
+        Write(aNow);
     }
 
 exit:
@@ -258,39 +253,92 @@ exit:
     if (error != OTBR_ERROR_NONE)
     {
         mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-        Write();
+        Write(aNow);
     }
 }
 
-void Connection::ProcessWaitCallback(void)
+void Connection::ProcessWaitCallback(steady_clock::time_point aNow)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = aNow - mTimeStamp;
 
-    mResource->HandleCallback(mRequest, mResponse);
+    if (mResponse.IsBodyDeferred())
+    {
+        mResponse.ResolveDeferredBody();
+    }
+    else
+    {
+        mResource->HandleCallback(mRequest, mResponse);
+    }
 
-    if (mResponse.IsComplete())
+    if (mResponse.IsChunked())
     {
-        Write();
+        if (!mResponse.IsComplete() && !mResponse.IsPersistent() && duration >= kCallbackTimeout)
+        {
+            // The headers may have been sent, so terminate the body instead of replying an error.
+            mResponse.SetComplete();
+        }
+
+        if (mResponse.IsComplete())
+        {
+            Write(aNow);
+        }
+        else
+        {
+            mWriteContent += mResponse.SerializeChunks();
+            WriteChunks();
+
+            // A subscriber which stops reading would make the pending events grow forever.
+            if (mState != ConnectionState::kComplete && mResponse.IsPersistent() &&
+                mWriteContent.size() > kMaxPendingStreamSize)
+            {
+                otbrLogWarning("Disconnect a slow stream subscriber with %zu bytes pending", mWriteContent.size());
+                Disconnect();
+            }
+        }
+    }
+    else if (mResponse.IsComplete())
+    {
+        Write(aNow);
     }
     else
     {
         if (duration >= kCallbackTimeout)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
+            Write(aNow);
         }
     }
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::WriteChunks(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    int32_t sendLength;
+
+    VerifyOrExit(!mWriteContent.empty());
+
+    // A persistent stream usually finds out the peer is gone on write, which must not raise SIGPIPE.
+    sendLength = send(mFd, mWriteContent.c_str(), mWriteContent.size(), MSG_NOSIGNAL);
+
+    if (sendLength > 0)
+    {
+        mWriteContent.erase(0, sendLength);
+    }
+    else if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        Disconnect();
+    }
+
+exit:
+    return;
+}
 
-    if (duration <= kWriteTimeout)
+void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet, steady_clock::time_point aNow)
+{
+    if (aNow <= mDeadline)
     {
         if (FD_ISSET(mFd, &aWriteFdSet))
         {
-            Write();
+            Write(aNow);
         }
     }
     else
@@ -299,7 +347,7 @@ void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
     }
 }
 
-void Connection::Write(void)
+void Connection::Write(steady_clock::time_point aNow)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorCode;
@@ -309,15 +357,24 @@ void Connection::Write(void)
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = aNow;
+
+        if (mResponse.IsChunked())
+        {
+            // The chunks which have not been written yet are kept in the write buffer.
+            mWriteContent += mResponse.SerializeChunks();
+        }
+        else
+        {
+            mWriteContent = mResponse.Serialize();
+        }
     }
 
     // Check we do have something to write.
     VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
+    sendLength = send(mFd, mWriteContent.c_str(), mWriteContent.size(), MSG_NOSIGNAL);
     err        = errno;
 
     // Write successfully
@@ -336,7 +393,7 @@ void Connection::Write(void)
         if (errno == EINTR)
         {
             // Try again
-            Write();
+            Write(aNow);
         }
         else
         {
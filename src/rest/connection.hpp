@@ -46,41 +46,65 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
+class RestWebServer;
+
 /**
  * This class implements a Connection class of each socket connection.
  *
+ * Connections are owned and driven by the REST server, which reuses a connection instance for another socket once
+ * it is complete.
+ *
  */
-class Connection : public MainloopProcessor
+class Connection
 {
 public:
     /**
-     * The constructor is to initialize a socket connection instance.
+     * The constructor is to initialize a connection instance.
      *
-     * @param[in] aStartTime  The reference start time of a connection which
-     *                        is set when created for the first time and maybe
-     *                        reset when transfer to wait callback or wait write
-     *                        state.
      * @param[in] aResource   A pointer to the resource handler.
-     * @param[in] aFd         The file descriptor for the connection.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    explicit Connection(Resource *aResource);
 
     /**
      * The desctructor destroys the connection instance.
      *
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
-     * This method initializes the connection.
+     * This method initializes the connection for a newly accepted socket.
      *
+     * @param[in] aFd   The file descriptor for the connection.
+     * @param[in] aNow  The current time, which is the reference start time of the connection.
      *
      */
-    void Init(void);
+    void Init(int aFd, steady_clock::time_point aNow);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method updates the file descriptor sets with the file descriptor of this connection.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context.
+     *
+     */
+    void Update(MainloopContext &aMainloop) const;
+
+    /**
+     * This method processes this connection.
+     *
+     * @param[in] aMainloop  A reference to the mainloop context.
+     * @param[in] aNow       The current time.
+     *
+     */
+    void Process(const MainloopContext &aMainloop, steady_clock::time_point aNow);
+
+    /**
+     * This method returns the time by which this connection needs to be processed again.
+     *
+     * @returns The deadline of this connection.
+     *
+     */
+    steady_clock::time_point GetDeadline(void) const { return mDeadline; }
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -92,19 +116,29 @@ public:
     bool IsComplete(void) const;
 
 private:
+    friend class RestWebServer;
+
     void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
     void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
-    void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
-    void Write(void);
-    void Handle(void);
+    void UpdateDeadline(steady_clock::time_point aNow);
+    void ProcessWaitRead(const fd_set &aReadFdSet, steady_clock::time_point aNow);
+    void ProcessWaitCallback(steady_clock::time_point aNow);
+    void ProcessWaitWrite(const fd_set &aWriteFdSet, steady_clock::time_point aNow);
+    void Write(steady_clock::time_point aNow);
+    void WriteChunks(void);
+    void Handle(steady_clock::time_point aNow);
     void Disconnect(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
 
+    // Time by which this connection needs to be processed again
+    steady_clock::time_point mDeadline;
+
+    // Neighbors in the timeout list of the REST server
+    Connection *mPrev;
+    Connection *mNext;
+
     // File descriptor for this connection
     int mFd;
 
@@ -0,0 +1,217 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "REST"
+
+#include "rest/diagnostic_collector.hpp"
+
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+namespace otbr {
+namespace rest {
+
+// Timeout (in Microseconds) for deleting outdated diagnostics
+static const uint32_t kDiagResetTimeout = 3000000;
+
+// Timeout (in Microseconds) for collecting diagnostics
+static const uint32_t kDiagCollectTimeout = 2000000;
+
+// The bits of a RLOC16 which identify the parent router
+static const uint16_t kRouterRloc16Mask = 0xfc00;
+
+DiagnosticCollector::DiagnosticCollector(void)
+    : mInstance(nullptr)
+    , mTopologyModel(nullptr)
+    , mQueryInFlight(false)
+    , mQuerySequence(0)
+    , mSequence(0)
+{
+}
+
+void DiagnosticCollector::Init(otInstance *aInstance, agent::TopologyModel &aTopologyModel)
+{
+    mInstance      = aInstance;
+    mTopologyModel = &aTopologyModel;
+    mQueryInFlight = false;
+    mPendingNodes.clear();
+    mAnsweredNodes.clear();
+    mTopologyModel->AddDiagnosticHandler(
+        [this](uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs) { HandleDiagnostic(aRloc16, aTlvs); });
+}
+
+otbrError DiagnosticCollector::Query(steady_clock::time_point &aStartTime, uint32_t &aSequence)
+{
+    otbrError    error       = OTBR_ERROR_NONE;
+    uint8_t      maxRouterId = otThreadGetMaxRouterId(mInstance);
+    otRouterInfo routerInfo;
+
+    // Join the query in flight, its responses serve all the waiting requests.
+    VerifyOrExit(!mQueryInFlight || IsQueryDone(mQueryStartTime));
+
+    mPendingNodes.clear();
+    mAnsweredNodes.clear();
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) == OT_ERROR_NONE)
+        {
+            mPendingNodes.insert(routerInfo.mRloc16);
+        }
+    }
+    mPendingNodes.insert(otThreadGetRloc16(mInstance));
+
+    VerifyOrExit(mTopologyModel->SendQuery() == OTBR_ERROR_NONE, error = OTBR_ERROR_REST);
+
+    mQueryInFlight  = true;
+    mQueryStartTime = steady_clock::now();
+    mQuerySequence  = mSequence;
+
+exit:
+    aStartTime = mQueryStartTime;
+    aSequence  = mQuerySequence;
+    return error;
+}
+
+bool DiagnosticCollector::IsQueryDone(steady_clock::time_point aStartTime)
+{
+    if (mQueryInFlight)
+    {
+        auto duration = duration_cast<microseconds>(steady_clock::now() - mQueryStartTime).count();
+
+        mQueryInFlight = !mPendingNodes.empty() && duration < kDiagCollectTimeout;
+    }
+
+    // A query started after @p aStartTime means that the query joined at @p aStartTime has completed.
+    return !mQueryInFlight || mQueryStartTime > aStartTime;
+}
+
+std::vector<std::vector<otNetworkDiagTlv>> DiagnosticCollector::GetDiagnostics(void)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+
+    DeleteOutdatedDiagnostics();
+
+    for (const auto &diag : mDiagSet)
+    {
+        diagContentSet.push_back(diag.second.mTlvs);
+    }
+
+    return diagContentSet;
+}
+
+std::vector<const DiagnosticCollector::NodeDiag *> DiagnosticCollector::GetUpdatedDiagnostics(
+    uint32_t &aSequence) const
+{
+    std::vector<const NodeDiag *> updated;
+    uint32_t                      sequence = aSequence;
+
+    for (const auto &diag : mDiagSet)
+    {
+        if (diag.second.mSequence > aSequence)
+        {
+            updated.push_back(&diag.second);
+            sequence = std::max(sequence, diag.second.mSequence);
+        }
+    }
+
+    aSequence = sequence;
+
+    return updated;
+}
+
+const DiagnosticCollector::NodeDiag *DiagnosticCollector::GetNodeDiagnostic(uint16_t aRloc16)
+{
+    const NodeDiag *node = nullptr;
+
+    DeleteOutdatedDiagnostics();
+
+    auto it = mDiagSet.find(aRloc16);
+    if (it != mDiagSet.end())
+    {
+        node = &it->second;
+    }
+
+    return node;
+}
+
+void DiagnosticCollector::DeleteOutdatedDiagnostics(void)
+{
+    steady_clock::time_point now = steady_clock::now();
+
+    for (auto it = mDiagSet.begin(); it != mDiagSet.end();)
+    {
+        if (duration_cast<microseconds>(now - it->second.mUpdateTime).count() >= kDiagResetTimeout)
+        {
+            it = mDiagSet.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void DiagnosticCollector::HandleDiagnostic(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs)
+{
+    NodeDiag &node = mDiagSet[aRloc16];
+
+    node.mUpdateTime = steady_clock::now();
+    node.mSequence   = ++mSequence;
+    node.mTlvs       = aTlvs;
+
+    mAnsweredNodes.insert(aRloc16);
+    mPendingNodes.erase(aRloc16);
+
+    // The full Thread device children subscribe to the all routers address, so wait for their responses too.
+    for (const otNetworkDiagTlv &tlv : aTlvs)
+    {
+        if (tlv.mType != OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE)
+        {
+            continue;
+        }
+
+        for (uint16_t i = 0; i < tlv.mData.mChildTable.mCount; ++i)
+        {
+            const otNetworkDiagChildEntry &child       = tlv.mData.mChildTable.mTable[i];
+            uint16_t                       childRloc16 = (aRloc16 & kRouterRloc16Mask) | child.mChildId;
+
+            if (child.mMode.mDeviceType && mAnsweredNodes.count(childRloc16) == 0)
+            {
+                mPendingNodes.insert(childRloc16);
+            }
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,164 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the network diagnostics collector for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
+#define OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
+
+#include <chrono>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <openthread/instance.h>
+#include <openthread/netdiag.h>
+
+#include "common/types.hpp"
+#include "utils/topology_model.hpp"
+
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class collects the network diagnostics of the Thread network.
+ *
+ * A single diagnostic query is shared by all the requests which arrive while it is in flight, and the query
+ * completes as soon as all the expected nodes have answered, or when the collect timeout expires. The expected
+ * nodes are the known routers, and the full Thread device children (REEDs and FEDs) found in the child tables
+ * of the responses, since they also answer the query.
+ *
+ */
+class DiagnosticCollector
+{
+public:
+    /**
+     * This structure represents the diagnostics of a node.
+     *
+     */
+    struct NodeDiag
+    {
+        steady_clock::time_point      mUpdateTime; ///< The time when the diagnostics are received.
+        uint32_t                      mSequence;   ///< The sequence number of the update.
+        std::vector<otNetworkDiagTlv> mTlvs;       ///< The diagnostic TLVs.
+    };
+
+    /**
+     * The constructor initializes the collector.
+     *
+     */
+    DiagnosticCollector(void);
+
+    /**
+     * This method initializes the collector.
+     *
+     * It should be called again after the NCP is reset, because the OpenThread instance and the topology model
+     * are recreated. The query in flight is abandoned.
+     *
+     * @param[in] aInstance       The OpenThread instance.
+     * @param[in] aTopologyModel  The topology model which sends the diagnostic queries.
+     *
+     */
+    void Init(otInstance *aInstance, agent::TopologyModel &aTopologyModel);
+
+    /**
+     * This method starts a diagnostic query, or joins the query in flight.
+     *
+     * @param[out] aStartTime  The time to pass to `IsQueryDone()`.
+     * @param[out] aSequence   The sequence number before the query, the nodes updated by the query have
+     *                         larger sequence numbers.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully started or joined a query.
+     * @retval OTBR_ERROR_REST  Failed to send the diagnostic requests.
+     *
+     */
+    otbrError Query(steady_clock::time_point &aStartTime, uint32_t &aSequence);
+
+    /**
+     * This method indicates whether the query joined at @p aStartTime has completed.
+     *
+     * @param[in] aStartTime  The time returned by `Query()`.
+     *
+     * @returns Whether the query has completed.
+     *
+     */
+    bool IsQueryDone(steady_clock::time_point aStartTime);
+
+    /**
+     * This method returns the diagnostics of the nodes which are not outdated.
+     *
+     * @returns The diagnostics of each node.
+     *
+     */
+    std::vector<std::vector<otNetworkDiagTlv>> GetDiagnostics(void);
+
+    /**
+     * This method returns the diagnostics of the nodes updated after a sequence number.
+     *
+     * @param[in,out] aSequence  The sequence number to start from, updated to the largest sequence number returned.
+     *
+     * @returns The diagnostics of the updated nodes.
+     *
+     */
+    std::vector<const NodeDiag *> GetUpdatedDiagnostics(uint32_t &aSequence) const;
+
+    /**
+     * This method returns the latest diagnostics of a node, which are not outdated.
+     *
+     * @param[in] aRloc16  The RLOC16 of the node.
+     *
+     * @returns A pointer to the diagnostics of the node, or nullptr if there are none.
+     *
+     */
+    const NodeDiag *GetNodeDiagnostic(uint16_t aRloc16);
+
+private:
+    void HandleDiagnostic(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs);
+
+    void DeleteOutdatedDiagnostics(void);
+
+    otInstance                  *mInstance;
+    agent::TopologyModel        *mTopologyModel;
+    bool                         mQueryInFlight;
+    steady_clock::time_point     mQueryStartTime;
+    uint32_t                     mQuerySequence;
+    std::set<uint16_t>           mPendingNodes;
+    std::set<uint16_t>           mAnsweredNodes;
+    uint32_t                     mSequence;
+    std::map<uint16_t, NodeDiag> mDiagSet;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAGNOSTIC_COLLECTOR_HPP_
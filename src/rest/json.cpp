@@ -28,6 +28,8 @@
 
 #include "rest/json.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
 
@@ -110,8 +112,9 @@ static cJSON *Mode2Json(const otLinkModeConfig &aMode)
 static cJSON *IpAddr2Json(const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
+    char       addrString[Ip6Address::kStringSize];
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    return cJSON_CreateString(addr.ToString(addrString));
 }
 
 static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
@@ -235,124 +238,126 @@ std::string Node2JsonString(const NodeInfo &aNode)
     return ret;
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+static cJSON *Diag2Json(const std::vector<otNetworkDiagTlv> &aDiag)
 {
-    cJSON      *diagInfo          = cJSON_CreateArray();
-    cJSON      *diagInfoOfOneNode = nullptr;
-    cJSON      *addrList          = nullptr;
-    cJSON      *tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
+    cJSON   *diagInfoOfOneNode = cJSON_CreateObject();
+    cJSON   *addrList          = nullptr;
+    cJSON   *tableList         = nullptr;
+    uint64_t timeout;
 
-    for (auto diagItem : aDiagSet)
+    for (const otNetworkDiagTlv &diagTlv : aDiag)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        switch (diagTlv.mType)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
+                                  Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+            timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity", Connectivity2Json(diagTlv.mData.mConnectivity));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
+                                  Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-                addrList = cJSON_CreateArray();
+            addrList = cJSON_CreateArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
+            }
+            cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel", cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage", cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-                tableList = cJSON_CreateArray();
+            tableList = cJSON_CreateArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+            {
+                cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
+            }
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+            cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "ChannelPages",
+                                  Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
+                                  cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
 
-                break;
-            default:
-                break;
-            }
+            break;
+        default:
+            break;
         }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
+    }
+
+    return diagInfoOfOneNode;
+}
+
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    cJSON      *diagInfo = cJSON_CreateArray();
+    std::string ret;
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        cJSON_AddItemToArray(diagInfo, Diag2Json(diagItem));
     }
 
     ret = Json2String(diagInfo);
@@ -362,6 +367,95 @@ std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aD
     return ret;
 }
 
+std::string NodeDiag2JsonString(const std::vector<otNetworkDiagTlv> &aDiag)
+{
+    cJSON      *diagInfo = Diag2Json(aDiag);
+    char       *jsonOut  = cJSON_PrintUnformatted(diagInfo);
+    std::string ret;
+
+    if (jsonOut != nullptr)
+    {
+        ret = jsonOut;
+        cJSON_free(jsonOut);
+    }
+
+    cJSON_Delete(diagInfo);
+
+    return ret;
+}
+
+static cJSON *TopologyRoute2Json(const agent::TopologyModel::Route &aRoute)
+{
+    cJSON *route = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(route, "RouterRloc16", cJSON_CreateNumber(aRoute.mRouterRloc16));
+    cJSON_AddItemToObject(route, "LinkQualityIn", cJSON_CreateNumber(aRoute.mLinkQualityIn));
+    cJSON_AddItemToObject(route, "LinkQualityOut", cJSON_CreateNumber(aRoute.mLinkQualityOut));
+    cJSON_AddItemToObject(route, "RouteCost", cJSON_CreateNumber(aRoute.mRouteCost));
+
+    return route;
+}
+
+static cJSON *TopologyChild2Json(const agent::TopologyModel::Child &aChild)
+{
+    cJSON *child = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(child, "Rloc16", cJSON_CreateNumber(aChild.mRloc16));
+    cJSON_AddItemToObject(child, "Timeout", cJSON_CreateNumber(aChild.mTimeout));
+    cJSON_AddItemToObject(child, "Mode", Mode2Json(aChild.mMode));
+
+    return child;
+}
+
+static cJSON *TopologyNode2Json(const agent::TopologyModel::Node &aNode, Timepoint aNow)
+{
+    cJSON *node     = cJSON_CreateObject();
+    cJSON *routes   = cJSON_CreateArray();
+    cJSON *children = cJSON_CreateArray();
+    auto   age      = std::chrono::duration_cast<Seconds>(aNow - aNode.mUpdateTime).count();
+
+    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
+    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+    cJSON_AddItemToObject(node, "Mode", Mode2Json(aNode.mMode));
+    cJSON_AddItemToObject(node, "Age", cJSON_CreateNumber(age));
+
+    for (const agent::TopologyModel::Route &route : aNode.mRoutes)
+    {
+        cJSON_AddItemToArray(routes, TopologyRoute2Json(route));
+    }
+    cJSON_AddItemToObject(node, "Routes", routes);
+
+    for (const agent::TopologyModel::Child &child : aNode.mChildren)
+    {
+        cJSON_AddItemToArray(children, TopologyChild2Json(child));
+    }
+    cJSON_AddItemToObject(node, "Children", children);
+
+    return node;
+}
+
+std::string Topology2JsonString(const agent::TopologyModel::Snapshot &aTopology)
+{
+    cJSON      *topology = cJSON_CreateObject();
+    cJSON      *nodes    = cJSON_CreateArray();
+    Timepoint   now      = Clock::now();
+    std::string ret;
+
+    cJSON_AddItemToObject(topology, "Version", cJSON_CreateNumber(aTopology.mVersion));
+    cJSON_AddItemToObject(topology, "RefreshInterval", cJSON_CreateNumber(aTopology.mRefreshInterval.count()));
+
+    for (const auto &node : aTopology.mNodes)
+    {
+        cJSON_AddItemToArray(nodes, TopologyNode2Json(node.second, now));
+    }
+    cJSON_AddItemToObject(topology, "Nodes", nodes);
+
+    ret = Json2String(topology);
+    cJSON_Delete(topology);
+
+    return ret;
+}
+
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
     cJSON      *hex = Bytes2HexJson(aBytes, aLength);
@@ -482,6 +576,101 @@ std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessag
     return ret;
 }
 
+static bool Json2BatchOperation(const cJSON *aJson, BatchOperation &aOperation)
+{
+    bool         ret    = false;
+    const cJSON *path   = aJson;
+    const cJSON *method = nullptr;
+    const cJSON *body   = nullptr;
+
+    aOperation.mMethod = HttpMethod::kGet;
+    aOperation.mBody.clear();
+
+    if (cJSON_IsObject(aJson))
+    {
+        path   = cJSON_GetObjectItemCaseSensitive(aJson, "Path");
+        method = cJSON_GetObjectItemCaseSensitive(aJson, "Method");
+        body   = cJSON_GetObjectItemCaseSensitive(aJson, "Body");
+    }
+
+    VerifyOrExit(cJSON_IsString(path) && path->valuestring[0] == '/');
+    aOperation.mPath = path->valuestring;
+
+    if (method != nullptr)
+    {
+        VerifyOrExit(cJSON_IsString(method));
+
+        if (strcmp(method->valuestring, "GET") == 0)
+        {
+            aOperation.mMethod = HttpMethod::kGet;
+        }
+        else if (strcmp(method->valuestring, "PUT") == 0)
+        {
+            aOperation.mMethod = HttpMethod::kPut;
+        }
+        else
+        {
+            ExitNow();
+        }
+    }
+
+    if (body != nullptr)
+    {
+        VerifyOrExit(cJSON_IsString(body));
+        aOperation.mBody = body->valuestring;
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+bool JsonString2BatchOperations(const std::string &aJsonString, std::vector<BatchOperation> &aOperations)
+{
+    bool         ret   = false;
+    cJSON       *batch = cJSON_Parse(aJsonString.c_str());
+    const cJSON *operation;
+
+    aOperations.clear();
+    VerifyOrExit(cJSON_IsArray(batch));
+
+    aOperations.reserve(cJSON_GetArraySize(batch));
+    cJSON_ArrayForEach(operation, batch)
+    {
+        aOperations.emplace_back();
+        VerifyOrExit(Json2BatchOperation(operation, aOperations.back()));
+    }
+
+    ret = true;
+
+exit:
+    cJSON_Delete(batch);
+    return ret;
+}
+
+std::string BatchResults2JsonString(const std::vector<BatchResult> &aResults)
+{
+    cJSON      *results = cJSON_CreateArray();
+    std::string ret;
+
+    for (const BatchResult &result : aResults)
+    {
+        cJSON *item = cJSON_CreateObject();
+        cJSON *body = cJSON_Parse(result.mBody.c_str());
+
+        cJSON_AddItemToObject(item, "Path", cJSON_CreateString(result.mPath.c_str()));
+        cJSON_AddItemToObject(item, "Status", cJSON_CreateNumber(result.mStatus));
+        cJSON_AddItemToObject(item, "Body", body != nullptr ? body : cJSON_CreateNull());
+        cJSON_AddItemToArray(results, item);
+    }
+
+    ret = Json2String(results);
+    cJSON_Delete(results);
+
+    return ret;
+}
+
 } // namespace Json
 } // namespace rest
 } // namespace otbr
@@ -39,6 +39,7 @@
 
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
+#include "utils/topology_model.hpp"
 
 namespace otbr {
 namespace rest {
@@ -122,6 +123,26 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method formats the diagnostic TLVs of a node to a Json object and serialize it to a single-line string.
+ *
+ * @param[in] aDiag  A vector of diagnostic TLVs.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string NodeDiag2JsonString(const std::vector<otNetworkDiagTlv> &aDiag);
+
+/**
+ * This method formats the topology model to a Json object and serialize it to a string.
+ *
+ * @param[in] aTopology  A snapshot of the topology model.
+ *
+ * @returns A string of serialized Json object.
+ *
+ */
+std::string Topology2JsonString(const agent::TopologyModel::Snapshot &aTopology);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
@@ -213,6 +234,31 @@ std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntr
  */
 std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage);
 
+/**
+ * This method parses the operations of a batch request.
+ *
+ * The batch is a Json array, each element of which is either the path of a resource to get, or an object with the
+ * "Path" of the resource, and the optional "Method" ("GET" by default) and "Body" (a string) of the operation.
+ *
+ * @param[in]  aJsonString   The Json string of the batch request.
+ * @param[out] aOperations   The parsed operations.
+ *
+ * @retval TRUE   Successfully parsed the batch.
+ * @retval FALSE  The batch is malformed.
+ *
+ */
+bool JsonString2BatchOperations(const std::string &aJsonString, std::vector<BatchOperation> &aOperations);
+
+/**
+ * This method formats the results of a batch request to a Json array and serialize it to a string.
+ *
+ * @param[in] aResults  The results of the batch operations, whose bodies are Json strings.
+ *
+ * @returns A string of serialized Json array.
+ *
+ */
+std::string BatchResults2JsonString(const std::vector<BatchResult> &aResults);
+
 }; // namespace Json
 
 } // namespace rest
@@ -58,6 +58,24 @@ static int OnBody(http_parser *parser, const char *at, size_t len)
     return 0;
 }
 
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderField(at, len);
+
+    return 0;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderValue(at, len);
+
+    return 0;
+}
+
 static int OnMessageComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
@@ -97,8 +115,8 @@ void Parser::Init(void)
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
+    mSettings.on_header_field     = OnHeaderField;
+    mSettings.on_header_value     = OnHeaderValue;
     mSettings.on_body             = OnBody;
     mSettings.on_headers_complete = OnHeaderComplete;
     mSettings.on_message_complete = OnMessageComplete;
@@ -28,22 +28,104 @@
 
 #include "rest/request.hpp"
 
+#include <algorithm>
+
+#include <ctype.h>
+
 namespace otbr {
 namespace rest {
 
+// The names of the headers in the order of `HttpHeader`.
+static const char *const kHeaderNames[] = {"accept", "if-none-match", "connection"};
+
+static bool EqualsIgnoreCase(const std::string &aLhs, const char *aRhs)
+{
+    size_t i = 0;
+
+    for (; i < aLhs.size() && aRhs[i] != '\0'; ++i)
+    {
+        if (tolower(static_cast<unsigned char>(aLhs[i])) != aRhs[i])
+        {
+            break;
+        }
+    }
+
+    return i == aLhs.size() && aRhs[i] == '\0';
+}
+
 Request::Request(void)
     : mComplete(false)
+    , mHeaderValueParsing(false)
+    , mHeaderIndex(kNumHeaders)
 {
+    static_assert(sizeof(kHeaderNames) / sizeof(kHeaderNames[0]) == kNumHeaders, "kHeaderNames is not complete");
+}
+
+void Request::Reset(void)
+{
+    mMethod        = 0;
+    mContentLength = 0;
+    mComplete      = false;
+    mUrl.clear();
+    mBody.clear();
+    mHeaderField.clear();
+    mHeaderValueParsing = false;
+    mHeaderIndex        = kNumHeaders;
+
+    for (std::string &header : mHeaders)
+    {
+        header.clear();
+    }
+
+    mPathParameters.clear();
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    mUrl.append(aString, aLength);
 }
 
 void Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    mBody.append(aString, aLength);
+}
+
+void Request::SetHeaderField(const char *aString, size_t aLength)
+{
+    // The parser may report a field in several parts, and a field starts once the value of the last one ends.
+    if (mHeaderValueParsing)
+    {
+        mHeaderField.clear();
+        mHeaderValueParsing = false;
+    }
+
+    mHeaderField.append(aString, aLength);
+}
+
+void Request::SetHeaderValue(const char *aString, size_t aLength)
+{
+    if (!mHeaderValueParsing)
+    {
+        mHeaderValueParsing = true;
+
+        for (mHeaderIndex = 0; mHeaderIndex < kNumHeaders; ++mHeaderIndex)
+        {
+            if (EqualsIgnoreCase(mHeaderField, kHeaderNames[mHeaderIndex]))
+            {
+                break;
+            }
+        }
+
+        if (mHeaderIndex < kNumHeaders && !mHeaders[mHeaderIndex].empty())
+        {
+            mHeaders[mHeaderIndex] += ", ";
+        }
+    }
+
+    if (mHeaderIndex < kNumHeaders)
+    {
+        mHeaders[mHeaderIndex].append(aString, aLength);
+    }
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -61,24 +143,23 @@ HttpMethod Request::GetMethod() const
     return static_cast<HttpMethod>(mMethod);
 }
 
-std::string Request::GetBody() const
+const std::string &Request::GetBody() const
 {
     return mBody;
 }
 
-std::string Request::GetUrl(void) const
+StringView Request::GetUrl(void) const
 {
-    std::string url = mUrl;
+    StringView url(mUrl);
+    size_t     urlEnd = url.find('?');
 
-    size_t urlEnd = url.find("?");
-
-    if (urlEnd != std::string::npos)
+    if (urlEnd != StringView::npos)
     {
         url = url.substr(0, urlEnd);
     }
     while (!url.empty() && url[url.size() - 1] == '/')
     {
-        url.pop_back();
+        url.remove_suffix(1);
     }
 
     VerifyOrExit(url.size() > 0, url = "/");
@@ -87,6 +168,62 @@ exit:
     return url;
 }
 
+bool Request::GetQueryParameter(StringView aName, StringView &aValue) const
+{
+    bool       found = false;
+    StringView url(mUrl);
+    size_t     start = url.find('?');
+
+    while (start != StringView::npos)
+    {
+        size_t end     = std::min(url.find('&', start + 1), url.size());
+        size_t nameEnd = std::min(url.find('=', start + 1), end);
+
+        if (url.substr(start + 1, nameEnd - start - 1) == aName)
+        {
+            aValue = (nameEnd == end) ? StringView() : url.substr(nameEnd + 1, end - nameEnd - 1);
+            found  = true;
+            break;
+        }
+
+        start = (end == url.size()) ? StringView::npos : end;
+    }
+
+    return found;
+}
+
+StringView Request::GetHeader(HttpHeader aHeader) const
+{
+    return mHeaders[static_cast<uint8_t>(aHeader)];
+}
+
+void Request::AddPathParameter(StringView aName, StringView aValue)
+{
+    mPathParameters.emplace_back(aName, aValue);
+}
+
+void Request::ClearPathParameters(void)
+{
+    mPathParameters.clear();
+}
+
+bool Request::GetPathParameter(StringView aName, StringView &aValue) const
+{
+    bool found = false;
+
+    for (const auto &parameter : mPathParameters)
+    {
+        if (parameter.first == aName)
+        {
+            aValue = parameter.second;
+            found  = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
 void Request::SetReadComplete(void)
 {
     mComplete = true;
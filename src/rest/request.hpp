@@ -35,9 +35,11 @@
 #define OTBR_REST_REQUEST_HPP_
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/code_utils.hpp"
+#include "common/string_view.hpp"
 #include "rest/types.hpp"
 
 namespace otbr {
@@ -56,6 +58,12 @@ public:
      */
     Request(void);
 
+    /**
+     * This method resets the request for parsing a new one, the buffers are kept for reuse.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method sets the Url field of a request.
      *
@@ -74,6 +82,26 @@ public:
      */
     void SetBody(const char *aString, size_t aLength);
 
+    /**
+     * This method appends a part of the name of a header field.
+     *
+     * @param[in] aString  A pointer points to the part of the name.
+     * @param[in] aLength  Length of the part of the name.
+     *
+     */
+    void SetHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method appends a part of the value of the header field whose name is set by `SetHeaderField()`.
+     *
+     * Only the headers in `HttpHeader` are kept, and the values of repeated headers are joined with commas.
+     *
+     * @param[in] aString  A pointer points to the part of the value.
+     * @param[in] aLength  Length of the part of the value.
+     *
+     */
+    void SetHeaderValue(const char *aString, size_t aLength);
+
     /**
      * This method sets the content-length field of a request.
      *
@@ -110,18 +138,62 @@ public:
     HttpMethod GetMethod() const;
 
     /**
-     * This method returns the HTTP method of this request.
+     * This method returns the body of this request.
+     *
+     * @returns A reference to the body of this request.
+     */
+    const std::string &GetBody() const;
+
+    /**
+     * This method returns the path of the url for this request, without the query and the trailing slashes.
+     *
+     * @returns A view of the path of this request, which is "/" for an empty path.
+     */
+    StringView GetUrl(void) const;
+
+    /**
+     * This method gets the value of a query parameter of the url.
      *
-     * @returns A HttpMethod enum representing HTTP method of this request.
+     * @param[in]  aName   The name of the query parameter.
+     * @param[out] aValue  The value of the query parameter, empty if the parameter has no value.
+     *
+     * @returns Whether the query parameter is present.
      */
-    std::string GetBody() const;
+    bool GetQueryParameter(StringView aName, StringView &aValue) const;
 
     /**
-     * This method returns the url for this request.
+     * This method returns the value of a header.
+     *
+     * @param[in] aHeader  The header.
      *
-     * @returns A string contains the url of this request.
+     * @returns A view of the value of the header, empty if the header is absent.
      */
-    std::string GetUrl(void) const;
+    StringView GetHeader(HttpHeader aHeader) const;
+
+    /**
+     * This method adds a parameter matched from the path by the router.
+     *
+     * @param[in] aName   The name of the path parameter.
+     * @param[in] aValue  A view of the value in the url of this request.
+     *
+     */
+    void AddPathParameter(StringView aName, StringView aValue);
+
+    /**
+     * This method removes all the path parameters.
+     *
+     */
+    void ClearPathParameters(void);
+
+    /**
+     * This method gets the value of a path parameter.
+     *
+     * @param[in]  aName   The name of the path parameter.
+     * @param[out] aValue  The value of the path parameter.
+     *
+     * @returns Whether the path parameter is present.
+     */
+    bool GetPathParameter(StringView aName, StringView &aValue) const;
 
     /**
      * This method indicates whether this request is parsed completely.
@@ -131,11 +203,19 @@ public:
     bool IsComplete(void) const;
 
 private:
+    static constexpr uint8_t kNumHeaders = static_cast<uint8_t>(HttpHeader::kNumHeaders);
+
     int32_t     mMethod;
     size_t      mContentLength;
     std::string mUrl;
     std::string mBody;
     bool        mComplete;
+    std::string mHeaderField;
+    bool        mHeaderValueParsing;
+    uint8_t     mHeaderIndex;
+    std::string mHeaders[kNumHeaders];
+
+    std::vector<std::pair<StringView, StringView>> mPathParameters;
 };
 
 } // namespace rest
@@ -30,12 +30,15 @@
 
 #include "rest/resource.hpp"
 
+#include <ctype.h>
+
 #include "string.h"
 
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOSTICS "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_NODE "/diagnostics/{rloc16}"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
@@ -46,11 +49,17 @@
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
 #define OT_REST_RESOURCE_PATH_NODE_ACTIVE_DATASET_TLVS "/node/active-dataset-tlvs"
+#define OT_REST_RESOURCE_PATH_TOPOLOGY "/topology"
+#define OT_REST_RESOURCE_PATH_EVENTS "/events"
+#define OT_REST_RESOURCE_PATH_BATCH "/batch"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
 
+#define OT_REST_CONTENT_TYPE_NDJSON "application/x-ndjson"
+#define OT_REST_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
+
 #define OT_REST_HTTP_STATUS_200 "200 OK"
 #define OT_REST_HTTP_STATUS_202 "202 Accepted"
 #define OT_REST_HTTP_STATUS_400 "400 Bad Request"
@@ -69,17 +78,31 @@ using std::placeholders::_2;
 namespace otbr {
 namespace rest {
 
-// MulticastAddr
-static const char *kMulticastAddrAllRouters = "ff03::2";
+// The query parameter for streaming diagnostics of each node as they arrive
+static const char *kDiagStreamParameter = "stream";
+
+// The query parameter for the comma-separated resources an event stream subscribes to
+static const char *kEventsResourcesParameter = "resources";
 
-// Default TlvTypes for Diagnostic inforamtion
-static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+// The interval for sending a comment on an idle event stream, which also detects the subscribers that have gone
+static const std::chrono::seconds kEventsKeepAliveInterval(15);
 
-// Timeout (in Microseconds) for deleting outdated diagnostics
-static const uint32_t kDiagResetTimeout = 3000000;
+// The maximum number of operations in a batch request
+static const size_t kMaxBatchOperations = 32;
 
-// Timeout (in Microseconds) for collecting diagnostics
-static const uint32_t kDiagCollectTimeout = 2000000;
+const Resource::EventResource Resource::kEventResources[] = {
+    {"state", OT_CHANGED_THREAD_ROLE, &Resource::GetDataState},
+    {"rloc16", OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED, &Resource::GetDataRloc16},
+    {"rloc", OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED, &Resource::GetDataRloc},
+    {"ext-address", OT_CHANGED_THREAD_LL_ADDR, &Resource::GetDataExtendedAddr},
+    {"network-name", OT_CHANGED_THREAD_NETWORK_NAME, &Resource::GetDataNetworkName},
+    {"ext-panid", OT_CHANGED_THREAD_EXT_PANID, &Resource::GetDataExtendedPanId},
+    {"leader-data", OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA,
+     &Resource::GetDataLeaderData},
+    {"active-dataset-tlvs", OT_CHANGED_ACTIVE_DATASET, &Resource::GetActiveDatasetTlvs},
+};
+
+const size_t Resource::kNumEventResources = sizeof(kEventResources) / sizeof(kEventResources[0]);
 
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
@@ -113,41 +136,176 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     return httpStatus;
 }
 
+static StringView TrimSpaces(StringView aString)
+{
+    while (!aString.empty() && aString[0] == ' ')
+    {
+        aString.remove_prefix(1);
+    }
+    while (!aString.empty() && aString[aString.size() - 1] == ' ')
+    {
+        aString.remove_suffix(1);
+    }
+
+    return aString;
+}
+
+// Parses a quality value, e.g. "0.5". The value has at most three decimal places, and parsing stops at the first
+// unexpected character like `strtod()`, but without copying the value into a null-terminated string.
+static double ParseQualityValue(StringView aValue)
+{
+    uint32_t integer  = 0;
+    uint32_t fraction = 0;
+    uint32_t divisor  = 1;
+    size_t   i        = 0;
+
+    for (; i < aValue.size() && isdigit(static_cast<unsigned char>(aValue[i])); ++i)
+    {
+        integer = std::min<uint32_t>(integer * 10 + static_cast<uint32_t>(aValue[i] - '0'), 1000);
+    }
+
+    if (i < aValue.size() && aValue[i] == '.')
+    {
+        for (++i; i < aValue.size() && isdigit(static_cast<unsigned char>(aValue[i])) && divisor < 1000; ++i)
+        {
+            fraction = fraction * 10 + static_cast<uint32_t>(aValue[i] - '0');
+            divisor *= 10;
+        }
+    }
+
+    return integer + static_cast<double>(fraction) / divisor;
+}
+
+// Returns the quality value of a media range of the Accept header, e.g. "application/cbor;q=0.5".
+static double GetMediaRangeQuality(StringView aMediaRange)
+{
+    double quality = 1;
+    size_t pos;
+
+    while ((pos = aMediaRange.find(';')) != StringView::npos)
+    {
+        StringView parameter;
+
+        aMediaRange.remove_prefix(pos + 1);
+        parameter = TrimSpaces(aMediaRange.substr(0, aMediaRange.find(';')));
+
+        if (parameter.starts_with("q="))
+        {
+            quality = ParseQualityValue(parameter.substr(2));
+        }
+    }
+
+    return quality;
+}
+
+// Picks CBOR only if the Accept header prefers it to JSON, so that JSON stays the default.
+static ContentFormat NegotiateContentFormat(const Request &aRequest)
+{
+    StringView    accept      = aRequest.GetHeader(HttpHeader::kAccept);
+    double        cborQuality = -1;
+    double        jsonQuality = -1;
+    double        anyQuality  = -1;
+    bool          more        = !accept.empty();
+    ContentFormat format      = ContentFormat::kJson;
+
+    while (more)
+    {
+        size_t     end        = accept.find(',');
+        StringView mediaRange = accept.substr(0, end);
+        StringView type       = TrimSpaces(mediaRange.substr(0, mediaRange.find(';')));
+        double     quality    = GetMediaRangeQuality(mediaRange);
+
+        if (type == "application/cbor")
+        {
+            cborQuality = quality;
+        }
+        else if (type == "application/json")
+        {
+            jsonQuality = quality;
+        }
+        else if (type == "*/*" || type == "application/*")
+        {
+            anyQuality = std::max(anyQuality, quality);
+        }
+
+        more = (end != StringView::npos);
+        if (more)
+        {
+            accept.remove_prefix(end + 1);
+        }
+    }
+
+    // A more specific media range overrides the wildcards.
+    cborQuality = (cborQuality < 0) ? anyQuality : cborQuality;
+    jsonQuality = (jsonQuality < 0) ? anyQuality : jsonQuality;
+
+    if (cborQuality > 0 && cborQuality > jsonQuality)
+    {
+        format = ContentFormat::kCbor;
+    }
+
+    return format;
+}
+
 Resource::Resource(ControllerOpenThread *aNcp)
     : mInstance(nullptr)
     , mNcp(aNcp)
+    , mEventStates(kNumEventResources)
+    , mEventSequence(0)
 {
+    static_assert(sizeof(kEventResources) / sizeof(kEventResources[0]) <= 32,
+                  "A subscription is a bitmask of at most 32 event resources");
+
     // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_ACTIVE_DATASET_TLVS, &Resource::ActiveDatasetTlvs);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::Diagnostic);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_DIAGNOSTICS_NODE, &Resource::NodeDiagnostic);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_ACTIVE_DATASET_TLVS, &Resource::ActiveDatasetTlvs);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_TOPOLOGY, &Resource::Topology);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_EVENTS, &Resource::Events);
+    mResourceRouter.Add(OT_REST_RESOURCE_PATH_BATCH, &Resource::Batch);
 
     // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
+    mResourceCallbackRouter.Add(OT_REST_RESOURCE_PATH_DIAGNOSTICS, &Resource::HandleDiagnosticCallback);
+    mResourceCallbackRouter.Add(OT_REST_RESOURCE_PATH_EVENTS, &Resource::HandleEventsCallback);
 }
 
 void Resource::Init(void)
 {
     mInstance = mNcp->GetThreadHelper()->GetInstance();
+    mDiagnosticCollector.Init(mInstance, mNcp->GetThreadHelper()->GetTopologyModel());
+
+    // The OpenThread instance and the topology model are recreated on reset.
+    mNcp->RegisterResetHandler([this]() {
+        mInstance = mNcp->GetThreadHelper()->GetInstance();
+        mDiagnosticCollector.Init(mInstance, mNcp->GetThreadHelper()->GetTopologyModel());
+    });
+
+    // The data of event resources is read once on each change and shared by all event streams.
+    for (size_t i = 0; i < kNumEventResources; ++i)
+    {
+        UpdateEventState(i);
+    }
+
+    mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    const ResourceHandler *resourceHandler = mResourceRouter.Match(aRequest);
 
-    if (it != mResourceMap.end())
+    if (resourceHandler != nullptr)
     {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        aResponse.SetContentFormat(NegotiateContentFormat(aRequest));
+        (this->**resourceHandler)(aRequest, aResponse);
     }
     else
     {
@@ -157,39 +315,186 @@ void Resource::Handle(Request &aRequest, Response &aResponse) const
 
 void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    const ResourceCallbackHandler *resourceHandler = mResourceCallbackRouter.Match(aRequest);
 
-    if (it != mResourceCallbackMap.end())
+    if (resourceHandler != nullptr)
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        (this->**resourceHandler)(aRequest, aResponse);
     }
 }
 
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
     OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    std::string errorCode;
+    bool        done = mDiagnosticCollector.IsQueryDone(aResponse.GetStartTime());
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
+    if (aResponse.IsChunked())
     {
-        DeleteOutDatedDiagnostic();
+        uint32_t cursor = aResponse.GetChunkCursor();
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+        for (const DiagnosticCollector::NodeDiag *node : mDiagnosticCollector.GetUpdatedDiagnostics(cursor))
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            aResponse.AppendChunk(Json::NodeDiag2JsonString(node->mTlvs) + "\n");
         }
+        aResponse.SetChunkCursor(cursor);
+
+        if (done)
+        {
+            aResponse.SetComplete();
+        }
+    }
+    else if (done)
+    {
+        ContentFormat format = aResponse.GetContentFormat();
+        auto          diagnostics =
+            std::make_shared<const std::vector<std::vector<otNetworkDiagTlv>>>(mDiagnosticCollector.GetDiagnostics());
+
+        SerializeBody(aResponse, [diagnostics, format](std::string &aBody) {
+            if (format == ContentFormat::kCbor)
+            {
+                Cbor::Diag2Cbor(*diagnostics, aBody);
+            }
+            else
+            {
+                aBody = Json::Diag2JsonString(*diagnostics);
+            }
+        });
 
-        body      = Json::Diag2JsonString(diagContentSet);
         errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
         aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
+
+        if (!aResponse.IsBodyDeferred())
+        {
+            aResponse.SetComplete();
+        }
+    }
+}
+
+void Resource::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    for (size_t i = 0; i < kNumEventResources; ++i)
+    {
+        if (aFlags & kEventResources[i].mFlags)
+        {
+            UpdateEventState(i);
+        }
+    }
+}
+
+void Resource::UpdateEventState(size_t aIndex)
+{
+    Response    response;
+    std::string data;
+
+    (this->*kEventResources[aIndex].mGetter)(response);
+
+    // The getters only complete the response on errors, e.g. there is no leader data when detached.
+    data = response.IsComplete() ? "null" : response.GetBody();
+
+    // A flag may fire without changing the data of a resource, which is not an event.
+    if (data != mEventStates[aIndex].mData)
+    {
+        mEventStates[aIndex].mData     = std::move(data);
+        mEventStates[aIndex].mSequence = ++mEventSequence;
+    }
+}
+
+bool Resource::ParseEventSubscription(const Request &aRequest, uint32_t &aSubscription)
+{
+    bool       valid = true;
+    bool       more  = true;
+    StringView resources;
+
+    if (!aRequest.GetQueryParameter(kEventsResourcesParameter, resources) || resources.empty())
+    {
+        // Subscribe to all event resources by default.
+        aSubscription = static_cast<uint32_t>((uint64_t{1} << kNumEventResources) - 1);
+        ExitNow();
+    }
+
+    aSubscription = 0;
+
+    while (more)
+    {
+        size_t     end = resources.find(',');
+        StringView name;
+        size_t     i;
+
+        more = (end != StringView::npos);
+        name = resources.substr(0, end);
+
+        for (i = 0; i < kNumEventResources; ++i)
+        {
+            if (name == kEventResources[i].mName)
+            {
+                aSubscription |= (1u << i);
+                break;
+            }
+        }
+
+        VerifyOrExit(i < kNumEventResources, valid = false);
+
+        if (more)
+        {
+            resources.remove_prefix(end + 1);
+        }
     }
+
+exit:
+    return valid;
+}
+
+void Resource::HandleEventsCallback(const Request &aRequest, Response &aResponse)
+{
+    uint32_t                 cursor       = aResponse.GetChunkCursor();
+    uint32_t                 subscription = aResponse.GetChunkFilter();
+    steady_clock::time_point now          = steady_clock::now();
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    // This is called on every mainloop iteration, so nothing is done unless there are new events.
+    if (cursor != mEventSequence)
+    {
+        for (size_t i = 0; i < kNumEventResources; ++i)
+        {
+            if ((subscription & (1u << i)) && mEventStates[i].mSequence > cursor)
+            {
+                aResponse.AppendChunk(std::string("event: ") + kEventResources[i].mName + "\ndata: " +
+                                      mEventStates[i].mData + "\n\n");
+                aResponse.SetStartTime(now);
+            }
+        }
+        aResponse.SetChunkCursor(mEventSequence);
+    }
+
+    if (now - aResponse.GetStartTime() >= kEventsKeepAliveInterval)
+    {
+        aResponse.AppendChunk(": keep-alive\n\n");
+        aResponse.SetStartTime(now);
+    }
+}
+
+void Resource::SerializeBody(Response &aResponse, BodySerializer aSerializer) const
+{
+    std::shared_ptr<Response::DeferredBody> deferredBody;
+
+    VerifyOrExit(aResponse.IsDeferrable(), aSerializer(aResponse.GetBodyBuffer()));
+
+    // Serialize on a worker thread so that large bodies do not delay the mainloop, which drives the radio.
+    deferredBody = aResponse.DeferBody();
+    mWorkerPool.Post([this, deferredBody, aSerializer]() {
+        std::shared_ptr<std::string> body = std::make_shared<std::string>();
+
+        aSerializer(*body);
+        mTaskRunner.Post([deferredBody, body]() {
+            deferredBody->mBody.swap(*body);
+            deferredBody->mReady = true;
+        });
+    });
+
+exit:
+    return;
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
@@ -197,6 +502,8 @@ void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) cons
     std::string errorMessage = GetHttpStatus(aErrorCode);
     std::string body         = Json::Error2JsonString(aErrorCode, errorMessage);
 
+    // Errors are always reported in JSON.
+    aResponse.SetContentFormat(ContentFormat::kJson);
     aResponse.SetResponsCode(errorMessage);
     aResponse.SetBody(body);
     aResponse.SetComplete();
@@ -231,8 +538,15 @@ void Resource::GetNodeInfo(Response &aResponse) const
     node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
     node.mRlocAddress = *otThreadGetRloc(mInstance);
 
-    body = Json::Node2JsonString(node);
-    aResponse.SetBody(body);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Node2Cbor(node, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Node2JsonString(node);
+        aResponse.SetBody(body);
+    }
 
 exit:
     if (error == OTBR_ERROR_NONE)
@@ -263,9 +577,18 @@ void Resource::GetDataExtendedAddr(Response &aResponse) const
 {
     const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
     std::string    errorCode;
-    std::string    body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+    std::string    body;
+
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Bytes2Cbor(extAddress, OT_EXT_ADDRESS_SIZE, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+        aResponse.SetBody(body);
+    }
 
-    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -295,9 +618,18 @@ void Resource::GetDataState(Response &aResponse) const
     // 3 : router
     // 4 : leader
 
-    role  = otThreadGetDeviceRole(mInstance);
-    state = Json::Number2JsonString(role);
-    aResponse.SetBody(state);
+    role = otThreadGetDeviceRole(mInstance);
+
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Number2Cbor(role, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        state = Json::Number2JsonString(role);
+        aResponse.SetBody(state);
+    }
+
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -322,9 +654,17 @@ void Resource::GetDataNetworkName(Response &aResponse) const
     std::string errorCode;
 
     networkName = otThreadGetNetworkName(mInstance);
-    networkName = Json::String2JsonString(networkName);
 
-    aResponse.SetBody(networkName);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::String2Cbor(networkName, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        networkName = Json::String2JsonString(networkName);
+        aResponse.SetBody(networkName);
+    }
+
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -352,9 +692,15 @@ void Resource::GetDataLeaderData(Response &aResponse) const
 
     VerifyOrExit(otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
 
-    body = Json::LeaderData2JsonString(leaderData);
-
-    aResponse.SetBody(body);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::LeaderData2Cbor(leaderData, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::LeaderData2JsonString(leaderData);
+        aResponse.SetBody(body);
+    }
 
 exit:
     if (error == OTBR_ERROR_NONE)
@@ -399,9 +745,16 @@ void Resource::GetDataNumOfRoute(Response &aResponse) const
         ++count;
     }
 
-    body = Json::Number2JsonString(count);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Number2Cbor(count, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Number2JsonString(count);
+        aResponse.SetBody(body);
+    }
 
-    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -426,9 +779,16 @@ void Resource::GetDataRloc16(Response &aResponse) const
     std::string body;
     std::string errorCode;
 
-    body = Json::Number2JsonString(rloc16);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Number2Cbor(rloc16, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Number2JsonString(rloc16);
+        aResponse.SetBody(body);
+    }
 
-    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -450,10 +810,19 @@ void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
 void Resource::GetDataExtendedPanId(Response &aResponse) const
 {
     const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    std::string    body     = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
+    std::string    body;
     std::string    errorCode;
 
-    aResponse.SetBody(body);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Bytes2Cbor(extPanId, OT_EXT_PAN_ID_SIZE, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
+        aResponse.SetBody(body);
+    }
+
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -478,9 +847,16 @@ void Resource::GetDataRloc(Response &aResponse) const
     std::string  body;
     std::string  errorCode;
 
-    body = Json::IpAddr2JsonString(rlocAddress);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::IpAddr2Cbor(rlocAddress, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::IpAddr2JsonString(rlocAddress);
+        aResponse.SetBody(body);
+    }
 
-    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -508,9 +884,16 @@ void Resource::GetActiveDatasetTlvs(Response &aResponse) const
 
     SuccessOrExit(error = otDatasetGetActiveTlvs(mInstance, &datasetTlvs));
 
-    body = Json::Bytes2HexJsonString(datasetTlvs.mTlvs, datasetTlvs.mLength);
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::Bytes2Cbor(datasetTlvs.mTlvs, datasetTlvs.mLength, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::Bytes2HexJsonString(datasetTlvs.mTlvs, datasetTlvs.mLength);
+        aResponse.SetBody(body);
+    }
 
-    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 
@@ -568,57 +951,67 @@ void Resource::ActiveDatasetTlvs(const Request &aRequest, Response &aResponse) c
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+void Resource::GetTopology(Response &aResponse) const
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
-    {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+    ContentFormat format = aResponse.GetContentFormat();
+    std::string   errorCode;
+
+    // The topology is served from the model, which is refreshed in the background.
+    auto topology = std::make_shared<const agent::TopologyModel::Snapshot>(
+        mNcp->GetThreadHelper()->GetTopologyModel().GetSnapshot());
 
-        if (duration >= kDiagResetTimeout)
+    SerializeBody(aResponse, [topology, format](std::string &aBody) {
+        if (format == ContentFormat::kCbor)
         {
-            eraseIt = mDiagSet.erase(eraseIt);
+            Cbor::Topology2Cbor(*topology, aBody);
         }
         else
         {
-            eraseIt++;
+            aBody = Json::Topology2JsonString(*topology);
         }
-    }
+    });
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+void Resource::Topology(const Request &aRequest, Response &aResponse) const
 {
-    DiagInfo value;
-
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetTopology(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
 }
 
 void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
-
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
+    otbrError                error = OTBR_ERROR_NONE;
+    steady_clock::time_point startTime;
+    uint32_t                 sequence;
+    StringView               stream;
+    std::string              errorCode;
+
+    SuccessOrExit(error = mDiagnosticCollector.Query(startTime, sequence));
+
+    if (aRequest.GetQueryParameter(kDiagStreamParameter, stream) && stream != "false")
+    {
+        // Stream the diagnostics of each node as a line of JSON as soon as it arrives.
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_NDJSON);
+        aResponse.SetChunked();
+        aResponse.SetChunkCursor(sequence);
+    }
 
 exit:
 
     if (error == OTBR_ERROR_NONE)
     {
-        aResponse.SetStartTime(steady_clock::now());
+        aResponse.SetStartTime(startTime);
         aResponse.SetCallback();
     }
     else
@@ -627,43 +1020,151 @@ exit:
     }
 }
 
-void Resource::DiagnosticResponseHandler(otError              aError,
-                                         otMessage           *aMessage,
-                                         const otMessageInfo *aMessageInfo,
-                                         void                *aContext)
+void Resource::Events(const Request &aRequest, Response &aResponse) const
 {
-    static_cast<Resource *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
+    uint32_t    subscription;
+    std::string errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+    VerifyOrExit(ParseEventSubscription(aRequest, subscription),
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+
+    // Stream Server-Sent Events, starting with the current data of all the subscribed resources.
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetContentType(OT_REST_CONTENT_TYPE_EVENT_STREAM);
+    aResponse.SetChunked();
+    aResponse.SetPersistent();
+    aResponse.SetChunkCursor(0);
+    aResponse.SetChunkFilter(subscription);
+    aResponse.SetStartTime(steady_clock::now());
+    aResponse.SetCallback();
+
+exit:
+    return;
 }
 
-void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
+void Resource::NodeDiagnostic(const Request &aRequest, Response &aResponse) const
 {
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    otbrError                            error = OTBR_ERROR_NONE;
+    StringView                           rloc16Parameter;
+    std::string                          rloc16String;
+    char                                *end;
+    unsigned long                        rloc16;
+    const DiagnosticCollector::NodeDiag *node;
+    std::string                          body;
+    std::string                          errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    // The RLOC16 could be either decimal or hexadecimal with the "0x" prefix.
+    VerifyOrExit(aRequest.GetPathParameter("rloc16", rloc16Parameter), error = OTBR_ERROR_REST);
+    rloc16String = rloc16Parameter.ToString();
+    rloc16       = strtoul(rloc16String.c_str(), &end, 0);
+    VerifyOrExit(!rloc16String.empty() && *end == '\0' && rloc16 <= UINT16_MAX, error = OTBR_ERROR_REST);
+
+    // The diagnostics are served from the latest collection, which is refreshed by the topology model.
+    node = mDiagnosticCollector.GetNodeDiagnostic(static_cast<uint16_t>(rloc16));
+    VerifyOrExit(node != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::NodeDiag2Cbor(node->mTlvs, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::NodeDiag2JsonString(node->mTlvs);
+        aResponse.SetBody(body);
+    }
 
-    SuccessOrExit(aError);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 
-    OTBR_UNUSED_VARIABLE(aMessageInfo);
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+}
 
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+void Resource::Batch(const Request &aRequest, Response &aResponse) const
+{
+    std::vector<BatchOperation> operations;
+    std::vector<BatchResult>    results;
+    Request                     request;
+    std::string                 body;
+    std::string                 errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kPost,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+    VerifyOrExit(Json::JsonString2BatchOperations(aRequest.GetBody(), operations) &&
+                     operations.size() <= kMaxBatchOperations,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+
+    // The operations are all handled before returning to the mainloop, so they see a single snapshot of the Thread
+    // state, which changes only by the previous operations of the batch.
+    results.resize(operations.size());
+    for (size_t i = 0; i < operations.size(); ++i)
     {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
-        {
-            snprintf(rloc, sizeof(rloc), "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
-        }
-        diagSet.push_back(diagTlv);
+        HandleBatchOperation(operations[i], aResponse.GetContentFormat(), request, results[i]);
     }
-    UpdateDiag(keyRloc, diagSet);
+
+    if (aResponse.GetContentFormat() == ContentFormat::kCbor)
+    {
+        Cbor::BatchResults2Cbor(results, aResponse.GetBodyBuffer());
+    }
+    else
+    {
+        body = Json::BatchResults2JsonString(results);
+        aResponse.SetBody(body);
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 
 exit:
-    if (aError != OT_ERROR_NONE)
+    return;
+}
+
+void Resource::HandleBatchOperation(const BatchOperation &aOperation,
+                                    ContentFormat         aFormat,
+                                    Request              &aRequest,
+                                    BatchResult          &aResult) const
+{
+    Response               response;
+    const ResourceHandler *resourceHandler;
+
+    aRequest.Reset();
+    aRequest.SetMethod(static_cast<int32_t>(aOperation.mMethod));
+    aRequest.SetUrl(aOperation.mPath.data(), aOperation.mPath.size());
+    aRequest.SetBody(aOperation.mBody.data(), aOperation.mBody.size());
+    aRequest.SetReadComplete();
+    response.SetContentFormat(aFormat);
+
+    // The resources answered in callbacks and nested batches would not complete within the batch.
+    if (mResourceCallbackRouter.Match(aRequest) != nullptr)
     {
-        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+        ErrorHandler(response, HttpStatusCode::kStatusBadRequest);
     }
+    else if ((resourceHandler = mResourceRouter.Match(aRequest)) == nullptr)
+    {
+        ErrorHandler(response, HttpStatusCode::kStatusResourceNotFound);
+    }
+    else if (*resourceHandler == &Resource::Batch)
+    {
+        ErrorHandler(response, HttpStatusCode::kStatusBadRequest);
+    }
+    else
+    {
+        (this->**resourceHandler)(aRequest, response);
+    }
+
+    aResult.mPath          = aOperation.mPath;
+    aResult.mStatus        = static_cast<uint16_t>(atoi(response.GetResponseCode().c_str()));
+    aResult.mContentFormat = response.GetContentFormat();
+    aResult.mBody          = response.GetBody();
 }
 
 } // namespace rest
@@ -34,14 +34,21 @@
 #ifndef OTBR_REST_RESOURCE_HPP_
 #define OTBR_REST_RESOURCE_HPP_
 
-#include <unordered_map>
+#include <functional>
+#include <memory>
+#include <vector>
 
 #include <openthread/border_router.h>
 
+#include "common/task_runner.hpp"
+#include "common/worker_pool.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "rest/cbor.hpp"
+#include "rest/diagnostic_collector.hpp"
 #include "rest/json.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/router.hpp"
 #include "utils/thread_helper.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
@@ -104,6 +111,26 @@ public:
 private:
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
+    typedef void (Resource::*ResourceDataGetter)(Response &aResponse) const;
+
+    // Serializes a snapshot of the Thread state into the body, which may run on a worker thread.
+    using BodySerializer = std::function<void(std::string &aBody)>;
+
+    // A resource whose changes are pushed to the subscribers of the event stream.
+    struct EventResource
+    {
+        const char        *mName;
+        otChangedFlags     mFlags;
+        ResourceDataGetter mGetter;
+    };
+
+    // The latest data of an event resource and the event sequence number when it last changed.
+    struct EventState
+    {
+        std::string mData;
+        uint32_t    mSequence;
+    };
+
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
     void ExtendedAddr(const Request &aRequest, Response &aResponse) const;
     void State(const Request &aRequest, Response &aResponse) const;
@@ -114,8 +141,23 @@ private:
     void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
     void Rloc(const Request &aRequest, Response &aResponse) const;
     void ActiveDatasetTlvs(const Request &aRequest, Response &aResponse) const;
+    void Topology(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void NodeDiagnostic(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void Events(const Request &aRequest, Response &aResponse) const;
+    void HandleEventsCallback(const Request &aRequest, Response &aResponse);
+    void Batch(const Request &aRequest, Response &aResponse) const;
+    void HandleBatchOperation(const BatchOperation &aOperation,
+                              ContentFormat         aFormat,
+                              Request              &aRequest,
+                              BatchResult          &aResult) const;
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+    void UpdateEventState(size_t aIndex);
+
+    static bool ParseEventSubscription(const Request &aRequest, uint32_t &aSubscription);
+
+    void SerializeBody(Response &aResponse, BodySerializer aSerializer) const;
 
     void GetNodeInfo(Response &aResponse) const;
     void GetDataExtendedAddr(Response &aResponse) const;
@@ -128,23 +170,25 @@ private:
     void GetDataRloc(Response &aResponse) const;
     void GetActiveDatasetTlvs(Response &aResponse) const;
     void SetActiveDatasetTlvs(const Request &aRequest, Response &aResponse) const;
-
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
-
-    static void DiagnosticResponseHandler(otError              aError,
-                                          otMessage           *aMessage,
-                                          const otMessageInfo *aMessageInfo,
-                                          void                *aContext);
-    void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    void GetTopology(Response &aResponse) const;
 
     otInstance           *mInstance;
     ControllerOpenThread *mNcp;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+    Router<ResourceHandler>         mResourceRouter;
+    Router<ResourceCallbackHandler> mResourceCallbackRouter;
+
+    mutable DiagnosticCollector mDiagnosticCollector;
+
+    static const EventResource kEventResources[];
+    static const size_t        kNumEventResources;
+
+    std::vector<EventState> mEventStates;
+    uint32_t                mEventSequence;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    // The worker pool is destroyed first, so the running serializers can still post to the task runner.
+    mutable TaskRunner mTaskRunner;
+    mutable WorkerPool mWorkerPool;
 };
 
 } // namespace rest
@@ -30,7 +30,10 @@
 
 #include <stdio.h>
 
+#include "common/code_utils.hpp"
+
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
+#define OT_REST_RESPONSE_CONTENT_TYPE_CBOR "application/cbor"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
@@ -43,6 +46,13 @@ namespace rest {
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mChunked(false)
+    , mHeadersSerialized(false)
+    , mChunkCursor(0)
+    , mChunkFilter(0)
+    , mPersistent(false)
+    , mContentFormat(ContentFormat::kJson)
+    , mDeferrable(false)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1";
@@ -79,6 +89,11 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
+const std::string &Response::GetResponseCode(void) const
+{
+    return mCode;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -94,12 +109,28 @@ std::string Response::GetBody(void) const
     return mBody;
 }
 
+std::string &Response::GetBodyBuffer(void)
+{
+    return mBody;
+}
+
 bool Response::NeedCallback(void)
 {
     return mCallback;
 }
 
 std::string Response::Serialize(void) const
+{
+    std::string spacer = "\r\n";
+    std::string ret(SerializeHeaders());
+
+    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+    ret += (spacer + spacer + mBody);
+
+    return ret;
+}
+
+std::string Response::SerializeHeaders(void) const
 {
     std::string spacer = "\r\n";
     std::string ret(mProtocol + " " + mCode);
@@ -108,11 +139,139 @@ std::string Response::Serialize(void) const
     {
         ret += (spacer + header.first + ": " + header.second);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
 
     return ret;
 }
 
+void Response::SetContentType(const std::string &aContentType)
+{
+    mHeaders["Content-Type"] = aContentType;
+}
+
+void Response::SetContentFormat(ContentFormat aFormat)
+{
+    mContentFormat = aFormat;
+    SetContentType(aFormat == ContentFormat::kCbor ? OT_REST_RESPONSE_CONTENT_TYPE_CBOR
+                                                   : OT_REST_RESPONSE_CONTENT_TYPE_JSON);
+}
+
+ContentFormat Response::GetContentFormat(void) const
+{
+    return mContentFormat;
+}
+
+void Response::SetChunked(void)
+{
+    mChunked = true;
+}
+
+bool Response::IsChunked(void) const
+{
+    return mChunked;
+}
+
+void Response::AppendChunk(const std::string &aData)
+{
+    char size[sizeof(size_t) * 2 + 1];
+
+    // An empty chunk would terminate the body.
+    if (!aData.empty())
+    {
+        snprintf(size, sizeof(size), "%zx", aData.size());
+        mBody += std::string(size) + "\r\n" + aData + "\r\n";
+    }
+}
+
+std::string Response::SerializeChunks(void)
+{
+    std::string ret;
+
+    if (!mHeadersSerialized)
+    {
+        ret                = SerializeHeaders() + "\r\nTransfer-Encoding: chunked\r\n\r\n";
+        mHeadersSerialized = true;
+    }
+
+    ret += mBody;
+    mBody.clear();
+
+    if (mComplete)
+    {
+        ret += "0\r\n\r\n";
+    }
+
+    return ret;
+}
+
+void Response::SetChunkCursor(uint32_t aCursor)
+{
+    mChunkCursor = aCursor;
+}
+
+uint32_t Response::GetChunkCursor(void) const
+{
+    return mChunkCursor;
+}
+
+void Response::SetChunkFilter(uint32_t aFilter)
+{
+    mChunkFilter = aFilter;
+}
+
+uint32_t Response::GetChunkFilter(void) const
+{
+    return mChunkFilter;
+}
+
+void Response::SetPersistent(void)
+{
+    mPersistent = true;
+}
+
+bool Response::IsPersistent(void) const
+{
+    return mPersistent;
+}
+
+void Response::SetDeferrable(void)
+{
+    mDeferrable = true;
+}
+
+bool Response::IsDeferrable(void) const
+{
+    return mDeferrable;
+}
+
+std::shared_ptr<Response::DeferredBody> Response::DeferBody(void)
+{
+    mDeferredBody = std::make_shared<DeferredBody>();
+    mCallback     = true;
+
+    return mDeferredBody;
+}
+
+bool Response::IsBodyDeferred(void) const
+{
+    return mDeferredBody != nullptr;
+}
+
+bool Response::IsDeferredBodyReady(void) const
+{
+    return mDeferredBody != nullptr && mDeferredBody->mReady;
+}
+
+void Response::ResolveDeferredBody(void)
+{
+    VerifyOrExit(IsDeferredBodyReady());
+
+    mBody = std::move(mDeferredBody->mBody);
+    mDeferredBody.reset();
+    mComplete = true;
+
+exit:
+    return;
+}
+
 } // namespace rest
 } // namespace otbr
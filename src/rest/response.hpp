@@ -36,6 +36,7 @@
 
 #include <chrono>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "rest/types.hpp"
@@ -56,6 +57,18 @@ namespace rest {
 class Response
 {
 public:
+    /**
+     * This structure represents a body which is serialized off the mainloop.
+     *
+     * It is only accessed on the mainloop, the serializer fills it by posting a task to the mainloop.
+     *
+     */
+    struct DeferredBody
+    {
+        bool        mReady = false; ///< Whether the body has been serialized.
+        std::string mBody;          ///< The serialized body.
+    };
+
     /**
      * The constructor to initialize a response instance.
      *
@@ -78,6 +91,13 @@ public:
      */
     std::string GetBody(void) const;
 
+    /**
+     * This method returns the body buffer, so that the body could be written in place.
+     *
+     * @returns A reference to the body buffer.
+     */
+    std::string &GetBodyBuffer(void);
+
     /**
      * This method set the response code.
      *
@@ -86,6 +106,14 @@ public:
      */
     void SetResponsCode(std::string &aCode);
 
+    /**
+     * This method returns the response code.
+     *
+     * @returns A string representing response code such as "404 not found".
+     *
+     */
+    const std::string &GetResponseCode(void) const;
+
     /**
      * This method labels the response as need callback.
      *
@@ -135,7 +163,150 @@ public:
      */
     std::string Serialize(void) const;
 
+    /**
+     * This method sets the content type of the response.
+     *
+     * @param[in] aContentType  A string representing the content type such as "application/json".
+     *
+     */
+    void SetContentType(const std::string &aContentType);
+
+    /**
+     * This method sets the format of the body, which also sets the content type.
+     *
+     * @param[in] aFormat  The format of the body.
+     *
+     */
+    void SetContentFormat(ContentFormat aFormat);
+
+    /**
+     * This method returns the format of the body set by `SetContentFormat()`.
+     *
+     * @returns The format of the body.
+     */
+    ContentFormat GetContentFormat(void) const;
+
+    /**
+     * This method labels the response as chunked, so that the body is sent in chunks while the callback handler
+     * is producing it.
+     *
+     */
+    void SetChunked(void);
+
+    /**
+     * This method checks whether the body of this response is sent in chunks.
+     *
+     * @returns A bool value indicates whether the body of this response is sent in chunks.
+     */
+    bool IsChunked(void) const;
+
+    /**
+     * This method appends data to the body of a chunked response.
+     *
+     * @param[in] aData  The data to be sent as a chunk.
+     *
+     */
+    void AppendChunk(const std::string &aData);
+
+    /**
+     * This method serializes the chunks appended since the last call to a string that could be sent by socket.
+     *
+     * The status line and headers are included by the first call, and the last chunk is included once the response
+     * is complete.
+     *
+     * @returns A string contains the serialized chunks.
+     */
+    std::string SerializeChunks(void);
+
+    /**
+     * This method sets a cursor recording how far the callback handler has produced the chunked body.
+     *
+     * @param[in] aCursor  The cursor.
+     *
+     */
+    void SetChunkCursor(uint32_t aCursor);
+
+    /**
+     * This method returns the cursor set by `SetChunkCursor()`.
+     *
+     * @returns The cursor.
+     */
+    uint32_t GetChunkCursor(void) const;
+
+    /**
+     * This method sets a filter selecting what the callback handler produces in the chunked body, so that the
+     * request doesn't need to be parsed again on every callback.
+     *
+     * @param[in] aFilter  The filter.
+     *
+     */
+    void SetChunkFilter(uint32_t aFilter);
+
+    /**
+     * This method returns the filter set by `SetChunkFilter()`.
+     *
+     * @returns The filter.
+     */
+    uint32_t GetChunkFilter(void) const;
+
+    /**
+     * This method labels the response as persistent, so that the connection keeps waiting for the callback handler
+     * until the response is complete or the peer goes away, instead of timing out.
+     *
+     */
+    void SetPersistent(void);
+
+    /**
+     * This method checks whether this response is persistent.
+     *
+     * @returns A bool value indicates whether this response is persistent.
+     */
+    bool IsPersistent(void) const;
+
+    /**
+     * This method allows the body of the response to be deferred, which is only possible when the connection waits
+     * for the callback of the response.
+     *
+     */
+    void SetDeferrable(void);
+
+    /**
+     * This method checks whether the body of this response can be deferred.
+     *
+     * @returns A bool value indicates whether the body of this response can be deferred.
+     */
+    bool IsDeferrable(void) const;
+
+    /**
+     * This method defers the body of the response, which completes the response once it is ready.
+     *
+     * @returns The deferred body to fill.
+     */
+    std::shared_ptr<DeferredBody> DeferBody(void);
+
+    /**
+     * This method checks whether the body of this response is deferred and not resolved yet.
+     *
+     * @returns A bool value indicates whether the body of this response is deferred.
+     */
+    bool IsBodyDeferred(void) const;
+
+    /**
+     * This method checks whether the deferred body of this response is ready to be resolved.
+     *
+     * @returns A bool value indicates whether the deferred body of this response is ready.
+     */
+    bool IsDeferredBodyReady(void) const;
+
+    /**
+     * This method completes the response with the deferred body if it is ready.
+     *
+     */
+    void ResolveDeferredBody(void);
+
 private:
+    std::string SerializeHeaders(void) const;
+
     bool                               mCallback;
     std::map<std::string, std::string> mHeaders;
     std::string                        mCode;
@@ -143,6 +314,14 @@ private:
     std::string                        mBody;
     bool                               mComplete;
     steady_clock::time_point           mStartTime;
+    bool                               mChunked;
+    bool                               mHeadersSerialized;
+    uint32_t                           mChunkCursor;
+    uint32_t                           mChunkFilter;
+    bool                               mPersistent;
+    ContentFormat                      mContentFormat;
+    bool                               mDeferrable;
+    std::shared_ptr<DeferredBody>      mDeferredBody;
 };
 
 } // namespace rest
@@ -33,8 +33,9 @@
 #include <arpa/inet.h>
 #include <cerrno>
 
-#include <fcntl.h>
+#include <string.h>
 
+#include "common/time.hpp"
 #include "utils/socket_utils.hpp"
 
 using std::chrono::duration_cast;
@@ -50,8 +51,11 @@ static const uint32_t kMaxServeNum = 500;
 static const uint32_t kPortNumber = 8081;
 
 RestWebServer::RestWebServer(ControllerOpenThread &aNcp, const std::string &aRestListenAddress)
-    : mResource(Resource(&aNcp))
+    : mResource(&aNcp)
     , mListenFd(-1)
+    , mInitialized(false)
+    , mTimeoutHead(nullptr)
+    , mTimeoutTail(nullptr)
 {
     mAddress.sin6_family = AF_INET6;
     mAddress.sin6_addr   = in6addr_any;
@@ -73,54 +77,170 @@ RestWebServer::~RestWebServer(void)
     }
 }
 
+void RestWebServer::Listen(void)
+{
+    if (mListenFd == -1)
+    {
+        InitializeListenFd();
+    }
+}
+
 void RestWebServer::Init(void)
 {
     mResource.Init();
-    InitializeListenFd();
+    Listen();
+    mInitialized = true;
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
 {
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    // Stop accepting until a connection is released when the server is full.
+    if (mInitialized && mConnections.size() - mFreeConnections.size() < kMaxServeNum)
+    {
+        FD_SET(mListenFd, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    }
+
+    for (Connection *connection = mTimeoutHead; connection != nullptr; connection = connection->mNext)
+    {
+        connection->Update(aMainloop);
+    }
+
+    // The list is ordered by deadline, so only the first connection decides the timeout.
+    if (mTimeoutHead != nullptr)
+    {
+        microseconds timeout = duration_cast<microseconds>(mTimeoutHead->GetDeadline() - steady_clock::now());
+        timeval      tv      = ToTimeval(std::max(timeout, microseconds::zero()));
 
-    return;
+        if (timercmp(&tv, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = tv;
+        }
+    }
 }
 
 void RestWebServer::Process(const MainloopContext &aMainloop)
 {
-    UpdateConnections(aMainloop.mReadFdSet);
+    steady_clock::time_point now = steady_clock::now();
+
+    if (mInitialized && FD_ISSET(mListenFd, &aMainloop.mReadFdSet))
+    {
+        AcceptConnections(now);
+    }
+
+    ProcessConnections(aMainloop, now);
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::AcceptConnections(steady_clock::time_point aNow)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    // Accept all the pending clients at once, so that a burst of requests is served in one iteration.
+    while (mConnections.size() - mFreeConnections.size() < kMaxServeNum)
+    {
+        Connection *connection;
+        int         fd = accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (fd < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to accept new connection: %s", strerror(errno));
+            }
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+            break;
+        }
+
+        connection = AllocateConnection();
+        connection->Init(fd, aNow);
+        LinkConnection(*connection);
+    }
+}
+
+void RestWebServer::ProcessConnections(const MainloopContext &aMainloop, steady_clock::time_point aNow)
+{
+    Connection *connection = mTimeoutHead;
+
+    // Detach the list and link the connections back with their new deadlines.
+    mTimeoutHead = nullptr;
+    mTimeoutTail = nullptr;
+
+    while (connection != nullptr)
     {
-        Connection *connection = eraseIt->second.get();
+        Connection *next = connection->mNext;
+
+        connection->Process(aMainloop, aNow);
 
         if (connection->IsComplete())
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            ReleaseConnection(*connection);
         }
         else
         {
-            eraseIt++;
+            LinkConnection(*connection);
         }
+
+        connection = next;
     }
+}
+
+Connection *RestWebServer::AllocateConnection(void)
+{
+    Connection *connection;
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    if (mFreeConnections.empty())
     {
-        error = Accept(mListenFd);
+        mConnections.emplace_back(new Connection(&mResource));
+        connection = mConnections.back().get();
+    }
+    else
+    {
+        connection = mFreeConnections.back();
+        mFreeConnections.pop_back();
     }
 
-    if (error != OTBR_ERROR_NONE)
+    return connection;
+}
+
+void RestWebServer::ReleaseConnection(Connection &aConnection)
+{
+    aConnection.mPrev = nullptr;
+    aConnection.mNext = nullptr;
+    mFreeConnections.push_back(&aConnection);
+}
+
+void RestWebServer::LinkConnection(Connection &aConnection)
+{
+    Connection *prev = mTimeoutTail;
+
+    // Most connections get the latest deadline, so search for the position from the tail.
+    while (prev != nullptr && aConnection.GetDeadline() < prev->GetDeadline())
     {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+        prev = prev->mPrev;
+    }
+
+    aConnection.mPrev = prev;
+    aConnection.mNext = (prev == nullptr) ? mTimeoutHead : prev->mNext;
+
+    if (aConnection.mNext != nullptr)
+    {
+        aConnection.mNext->mPrev = &aConnection;
+    }
+    else
+    {
+        mTimeoutTail = &aConnection;
+    }
+
+    if (prev != nullptr)
+    {
+        prev->mNext = &aConnection;
+    }
+    else
+    {
+        mTimeoutHead = &aConnection;
     }
 }
 
@@ -163,7 +283,7 @@ void RestWebServer::InitializeListenFd(void)
     ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(mAddress));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(mListenFd, SOMAXCONN);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
 exit:
@@ -176,68 +296,5 @@ exit:
     VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
-{
-    std::string errorMessage;
-    otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
-
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
-    err = errno;
-
-    VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
-
-    VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
-
-    CreateNewConnection(fd);
-
-exit:
-    if (error != OTBR_ERROR_NONE)
-    {
-        if (fd != -1)
-        {
-            close(fd);
-            fd = -1;
-        }
-        otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
-    }
-
-    return error;
-}
-
-void RestWebServer::CreateNewConnection(int &aFd)
-{
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
-
-    if (it.second == true)
-    {
-        Connection *connection = it.first->second.get();
-        connection->Init();
-    }
-    else
-    {
-        // failure on inserting new connection
-        close(aFd);
-        aFd = -1;
-    }
-}
-
-bool RestWebServer::SetFdNonblocking(int32_t fd)
-{
-    int32_t oldMode;
-    bool    ret = true;
-
-    oldMode = fcntl(fd, F_GETFL);
-
-    VerifyOrExit(fcntl(fd, F_SETFL, oldMode | O_NONBLOCK) >= 0, ret = false);
-
-exit:
-    return ret;
-}
-
 } // namespace rest
 } // namespace otbr
@@ -34,6 +34,9 @@
 #ifndef OTBR_REST_REST_WEB_SERVER_HPP_
 #define OTBR_REST_REST_WEB_SERVER_HPP_
 
+#include <memory>
+#include <vector>
+
 #include <netinet/in.h>
 #include <netinet/ip.h>
 #include <sys/socket.h>
@@ -69,7 +72,15 @@ public:
     ~RestWebServer(void) override;
 
     /**
-     * This method initializes the REST server.
+     * This method opens the listen socket of the REST server.
+     *
+     * The clients which connect before the server is initialized wait in the listen backlog.
+     *
+     */
+    void Listen(void);
+
+    /**
+     * This method initializes the REST server, and starts accepting clients.
      *
      */
     void Init(void);
@@ -78,12 +89,13 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
-    otbrError Accept(int32_t aListenFd);
-    bool      ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
-    void      InitializeListenFd(void);
-    bool      SetFdNonblocking(int32_t fd);
+    void        AcceptConnections(steady_clock::time_point aNow);
+    void        ProcessConnections(const MainloopContext &aMainloop, steady_clock::time_point aNow);
+    Connection *AllocateConnection(void);
+    void        ReleaseConnection(Connection &aConnection);
+    void        LinkConnection(Connection &aConnection);
+    bool        ParseListenAddress(const std::string listenAddress, struct in6_addr *sin6_addr);
+    void        InitializeListenFd(void);
 
     // Resource handler
     Resource mResource;
@@ -91,8 +103,14 @@ private:
     sockaddr_in6 mAddress;
     // File descriptor for listening
     int32_t mListenFd;
-    // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // Whether the clients are accepted
+    bool mInitialized;
+    // Slab of connections, the released ones are reused for new sockets
+    std::vector<std::unique_ptr<Connection>> mConnections;
+    std::vector<Connection *>                mFreeConnections;
+    // Intrusive list of the active connections in ascending order of deadline
+    Connection *mTimeoutHead;
+    Connection *mTimeoutTail;
 };
 
 } // namespace rest
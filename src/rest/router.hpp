@@ -0,0 +1,216 @@
+/*
+ *  Copyright (c) 2023, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the path router definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_ROUTER_HPP_
+#define OTBR_REST_ROUTER_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/string_view.hpp"
+#include "rest/request.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a router which maps the path of a request to a handler.
+ *
+ * The routes are compiled into a trie of path segments. A segment like `{rloc16}` is a path parameter which matches
+ * any segment and is passed to the handler through `Request::GetPathParameter()`. A literal segment takes precedence
+ * over a path parameter at the same level. Matching walks views into the url of the request, so it does not allocate
+ * memory.
+ *
+ */
+template <typename HandlerType> class Router
+{
+public:
+    /**
+     * The constructor initializes an empty router.
+     *
+     */
+    Router(void)
+        : mRoot(new Node())
+    {
+    }
+
+    /**
+     * This method adds a route.
+     *
+     * @param[in] aPattern  The path pattern, e.g. "/diagnostics/{rloc16}".
+     * @param[in] aHandler  The handler.
+     *
+     * @retval TRUE   Successfully added the route.
+     * @retval FALSE  A route with the same pattern already exists.
+     *
+     */
+    bool Add(StringView aPattern, HandlerType aHandler)
+    {
+        bool       added = false;
+        Node      *node  = mRoot.get();
+        StringView segment;
+
+        while (NextSegment(aPattern, segment))
+        {
+            bool        isParameter = segment.size() >= 2 && segment[0] == '{' && segment[segment.size() - 1] == '}';
+            std::string name        = segment.ToString();
+            Node       *child       = nullptr;
+
+            if (isParameter)
+            {
+                name = name.substr(1, name.size() - 2);
+            }
+
+            for (const std::unique_ptr<Node> &candidate : node->mChildren)
+            {
+                if (candidate->mIsParameter == isParameter && candidate->mSegment == name)
+                {
+                    child = candidate.get();
+                    break;
+                }
+            }
+
+            if (child == nullptr)
+            {
+                node->mChildren.emplace_back(new Node());
+                child               = node->mChildren.back().get();
+                child->mSegment     = std::move(name);
+                child->mIsParameter = isParameter;
+            }
+
+            node = child;
+        }
+
+        VerifyOrExit(!node->mHasHandler);
+        node->mHandler    = std::move(aHandler);
+        node->mHasHandler = true;
+        added             = true;
+
+    exit:
+        return added;
+    }
+
+    /**
+     * This method finds the handler of the path of a request, and sets the path parameters of the request.
+     *
+     * @param[in,out] aRequest  The request.
+     *
+     * @returns A pointer to the handler, or nullptr if not found.
+     *
+     */
+    const HandlerType *Match(Request &aRequest) const
+    {
+        const HandlerType *handler = nullptr;
+        const Node        *node    = mRoot.get();
+        StringView         path    = aRequest.GetUrl();
+        StringView         segment;
+
+        aRequest.ClearPathParameters();
+
+        while (node != nullptr && NextSegment(path, segment))
+        {
+            const Node *parameter = nullptr;
+            const Node *literal   = nullptr;
+
+            for (const std::unique_ptr<Node> &child : node->mChildren)
+            {
+                if (!child->mIsParameter && StringView(child->mSegment) == segment)
+                {
+                    literal = child.get();
+                    break;
+                }
+
+                if (child->mIsParameter && parameter == nullptr)
+                {
+                    parameter = child.get();
+                }
+            }
+
+            node = (literal != nullptr) ? literal : parameter;
+
+            if (literal == nullptr && parameter != nullptr)
+            {
+                aRequest.AddPathParameter(parameter->mSegment, segment);
+            }
+        }
+
+        if (node != nullptr && node->mHasHandler)
+        {
+            handler = &node->mHandler;
+        }
+
+        return handler;
+    }
+
+private:
+    struct Node
+    {
+        Node(void)
+            : mIsParameter(false)
+            , mHasHandler(false)
+            , mHandler()
+        {
+        }
+
+        std::string                        mSegment; // The literal segment, or the name of the path parameter.
+        bool                               mIsParameter;
+        bool                               mHasHandler;
+        HandlerType                        mHandler;
+        std::vector<std::unique_ptr<Node>> mChildren;
+    };
+
+    // Moves the next non-empty segment of a path to aSegment.
+    static bool NextSegment(StringView &aPath, StringView &aSegment)
+    {
+        size_t end;
+
+        while (!aPath.empty() && aPath[0] == '/')
+        {
+            aPath.remove_prefix(1);
+        }
+
+        end      = std::min(aPath.find('/'), aPath.size());
+        aSegment = aPath.substr(0, end);
+        aPath.remove_prefix(end);
+
+        return !aSegment.empty();
+    }
+
+    std::unique_ptr<Node> mRoot;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ROUTER_HPP_
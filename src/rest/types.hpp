@@ -56,6 +56,21 @@ enum class HttpMethod : std::uint8_t
 
 };
 
+enum class HttpHeader : std::uint8_t
+{
+    kAccept      = 0, ///< Accept
+    kIfNoneMatch = 1, ///< If-None-Match
+    kConnection  = 2, ///< Connection
+    kNumHeaders  = 3, ///< The number of parsed headers
+
+};
+
+enum class ContentFormat : std::uint8_t
+{
+    kJson = 0, ///< application/json
+    kCbor = 1, ///< application/cbor
+};
+
 enum class HttpStatusCode : std::uint16_t
 {
     kStatusOk                  = 200,
@@ -98,10 +113,19 @@ struct NodeInfo
     std::string    mNetworkName;
 };
 
-struct DiagInfo
+struct BatchOperation
+{
+    HttpMethod  mMethod;
+    std::string mPath;
+    std::string mBody;
+};
+
+struct BatchResult
 {
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
+    std::string   mPath;
+    uint16_t      mStatus;
+    ContentFormat mContentFormat;
+    std::string   mBody;
 };
 
 } // namespace rest
@@ -96,6 +96,7 @@ static otError OtbrErrorToOtError(otbrError aError)
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mRestorer(aPublisher)
 {
     mNcp.RegisterResetHandler(
         [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
@@ -121,6 +122,8 @@ void AdvertisingProxy::Stop()
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    mRestorer.Flush();
+
     otbrLogInfo("Stopped");
 }
 
@@ -149,8 +152,10 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
 
     if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
     {
+        std::string hostName = std::move(update->mHostName);
+
         mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        CompleteUpdate(aId, hostName, error);
     }
 }
 
@@ -165,11 +170,13 @@ void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId,
 
         if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
         {
+            std::string hostName = std::move(update->mHostName);
+
             // Erase before notifying OpenThread, because there are chances that new
             // elements may be added to `otSrpServerHandleServiceUpdateResult` and
             // the iterator will be invalidated.
             mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+            CompleteUpdate(aUpdateId, hostName, aError);
         }
         else
         {
@@ -217,6 +224,8 @@ void AdvertisingProxy::PublishAllHostsAndServices(void)
         PublishHostAndItsServices(host, nullptr);
     }
 
+    mRestorer.PublishRestoredHosts();
+
 exit:
     return;
 }
@@ -329,6 +338,12 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
         });
     }
 
+    // The hosts of updates are not committed yet, they are saved when the updates complete.
+    if (!hasUpdate)
+    {
+        UpdateSnapshot(hostName, aHost);
+    }
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -386,6 +401,93 @@ Mdns::Publisher::SubTypeList AdvertisingProxy::MakeSubTypeList(const otSrpServer
     return subTypeList;
 }
 
+void AdvertisingProxy::SetSnapshotFile(const std::string &aPath)
+{
+    mRestorer.Load(aPath);
+}
+
+void AdvertisingProxy::CompleteUpdate(otSrpServerServiceUpdateId aUpdateId,
+                                      const std::string         &aHostName,
+                                      otbrError                  aError)
+{
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+
+    // The update host only has the services in the update message, so the snapshot is updated with the
+    // committed host, which has all the registered services.
+    VerifyOrExit(aError == OTBR_ERROR_NONE && !aHostName.empty());
+    UpdateSnapshot(aHostName, FindHost(aHostName));
+
+exit:
+    return;
+}
+
+const otSrpServerHost *AdvertisingProxy::FindHost(const std::string &aHostName)
+{
+    const otSrpServerHost *host = nullptr;
+
+    while ((host = otSrpServerGetNextHost(GetInstance(), host)) != nullptr)
+    {
+        std::string hostName;
+        std::string hostDomain;
+
+        if (SplitFullHostName(otSrpServerHostGetFullName(host), hostName, hostDomain) == OTBR_ERROR_NONE &&
+            hostName == aHostName)
+        {
+            break;
+        }
+    }
+
+    return host;
+}
+
+void AdvertisingProxy::UpdateSnapshot(const std::string &aHostName, const otSrpServerHost *aHost)
+{
+    AdvertisingSnapshot::Host snapshotHost;
+    const otIp6Address       *hostAddresses;
+    uint8_t                   hostAddressNum;
+    otSrpServerLeaseInfo      leaseInfo;
+    const otSrpServerService *service = nullptr;
+
+    if (aHost == nullptr || otSrpServerHostIsDeleted(aHost))
+    {
+        mRestorer.RemoveHost(aHostName);
+        ExitNow();
+    }
+
+    hostAddresses = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
+    otSrpServerHostGetLeaseInfo(aHost, &leaseInfo);
+    snapshotHost.mName       = aHostName;
+    snapshotHost.mAddresses  = GetEligibleAddresses(hostAddresses, hostAddressNum);
+    snapshotHost.mExpireTime = AdvertisingSnapshot::WallClock::now() + Milliseconds(leaseInfo.mRemainingLease);
+
+    while ((service = otSrpServerHostFindNextService(aHost, service, OT_SRP_SERVER_FLAGS_BASE_TYPE_SERVICE_ONLY,
+                                                     /* aServiceName */ nullptr, /* aInstanceName */ nullptr)))
+    {
+        std::string    serviceName;
+        std::string    serviceType;
+        std::string    serviceDomain;
+        const uint8_t *txtData;
+        uint16_t       txtDataLength = 0;
+
+        if (otSrpServerServiceIsDeleted(service) ||
+            SplitFullServiceInstanceName(otSrpServerServiceGetFullName(service), serviceName, serviceType,
+                                         serviceDomain) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        txtData = otSrpServerServiceGetTxtData(service, &txtDataLength);
+        snapshotHost.mServices.push_back({serviceName, serviceType, MakeSubTypeList(service),
+                                          otSrpServerServiceGetPort(service),
+                                          std::vector<uint8_t>(txtData, txtData + txtDataLength)});
+    }
+
+    mRestorer.UpdateHost(std::move(snapshotHost));
+
+exit:
+    return;
+}
+
 } // namespace otbr
 
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
@@ -36,6 +36,8 @@
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
 
+#include <string>
+
 #include <stdint.h>
 
 #include <openthread/instance.h>
@@ -44,6 +46,7 @@
 #include "common/code_utils.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "sdp_proxy/advertising_restorer.hpp"
 
 namespace otbr {
 
@@ -75,15 +78,31 @@ public:
     /**
      * This method stops the Advertising Proxy.
      *
+     * The pending changes of the snapshot are written to the file.
+     *
      */
     void Stop();
 
     /**
      * This method publishes all registered hosts and services.
      *
+     * The hosts restored from the snapshot which have not registered again are published as well.
+     *
      */
     void PublishAllHostsAndServices(void);
 
+    /**
+     * This method sets the file which persists the advertised hosts and services across restarts, and
+     * restores the hosts and services in the file.
+     *
+     * The restored hosts and services are published when the mDNS publisher is ready. A restored host is
+     * reconciled when its SRP client registers again, and is unpublished when its lease expires.
+     *
+     * @param[in] aPath  The path of the snapshot file.
+     *
+     */
+    void SetSnapshotFile(const std::string &aPath);
+
 private:
     struct OutstandingUpdate
     {
@@ -101,6 +120,10 @@ private:
     static Mdns::Publisher::TxtList     MakeTxtList(const otSrpServerService *aSrpService);
     static Mdns::Publisher::SubTypeList MakeSubTypeList(const otSrpServerService *aSrpService);
     void                                OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError);
+    void CompleteUpdate(otSrpServerServiceUpdateId aUpdateId, const std::string &aHostName, otbrError aError);
+
+    const otSrpServerHost *FindHost(const std::string &aHostName);
+    void                   UpdateSnapshot(const std::string &aHostName, const otSrpServerHost *aHost);
 
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
 
@@ -132,6 +155,9 @@ private:
 
     // Task runner for running tasks in the context of the main thread.
     TaskRunner mTaskRunner;
+
+    // Restores the advertised hosts and services across restarts.
+    AdvertisingRestorer mRestorer;
 };
 
 } // namespace otbr
@@ -0,0 +1,258 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements restoring the hosts and services advertised by the Advertising Proxy.
+ */
+
+#define OTBR_LOG_TAG "ADPROXY"
+
+#include "sdp_proxy/advertising_restorer.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+
+#include <assert.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// Coalesces the snapshot updates of a burst of SRP registrations into one write.
+static constexpr Milliseconds kSaveDelay(1000);
+
+AdvertisingRestorer::AdvertisingRestorer(Mdns::Publisher &aPublisher)
+    : mPublisher(aPublisher)
+{
+}
+
+AdvertisingRestorer::~AdvertisingRestorer(void)
+{
+    // The worker pool drops the tasks which have not started, and the save task is never run.
+    Flush();
+}
+
+void AdvertisingRestorer::Load(const std::string &aPath)
+{
+    mSnapshot.SetPath(aPath);
+    VerifyOrExit(mSnapshot.IsEnabled());
+    SuccessOrExit(mSnapshot.Load());
+
+    for (const auto &entry : mSnapshot.GetHosts())
+    {
+        mRestoredHosts.insert(entry.first);
+    }
+
+    ExpireRestoredHosts();
+
+exit:
+    return;
+}
+
+void AdvertisingRestorer::PublishRestoredHosts(void)
+{
+    for (const std::string &hostName : mRestoredHosts)
+    {
+        const AdvertisingSnapshot::Host *host = mSnapshot.FindHost(hostName);
+
+        assert(host != nullptr);
+
+        otbrLogDebug("Publish restored SRP host '%s'", hostName.c_str());
+        mPublisher.PublishHost(hostName, host->mAddresses, [hostName](otbrError aError) {
+            otbrLogResult(aError, "Handle publish restored SRP host '%s'", hostName.c_str());
+        });
+
+        for (const AdvertisingSnapshot::Service &service : host->mServices)
+        {
+            std::string              instanceName = service.mInstanceName;
+            Mdns::Publisher::TxtList txtList;
+
+            if (Mdns::Publisher::DecodeTxtData(txtList, service.mTxtData.data(),
+                                               static_cast<uint16_t>(service.mTxtData.size())) != OTBR_ERROR_NONE)
+            {
+                otbrLogWarning("Failed to decode TXT data of restored SRP service '%s'", instanceName.c_str());
+                continue;
+            }
+
+            mPublisher.PublishService(hostName, service.mInstanceName, service.mType, service.mSubTypes,
+                                      service.mPort, txtList, [instanceName](otbrError aError) {
+                                          otbrLogResult(aError, "Handle publish restored SRP service '%s'",
+                                                        instanceName.c_str());
+                                      });
+        }
+    }
+}
+
+void AdvertisingRestorer::UpdateHost(AdvertisingSnapshot::Host aHost)
+{
+    Reconcile(aHost.mName, &aHost);
+
+    VerifyOrExit(mSnapshot.IsEnabled());
+    mSnapshot.SetHost(std::move(aHost));
+    ScheduleSave();
+
+exit:
+    return;
+}
+
+void AdvertisingRestorer::RemoveHost(const std::string &aName)
+{
+    Reconcile(aName, nullptr);
+
+    VerifyOrExit(mSnapshot.IsEnabled() && mSnapshot.FindHost(aName) != nullptr);
+    mSnapshot.RemoveHost(aName);
+    ScheduleSave();
+
+exit:
+    return;
+}
+
+void AdvertisingRestorer::Flush(void)
+{
+    std::shared_ptr<AdvertisingSnapshot> snapshot;
+    std::promise<void>                   saved;
+
+    VerifyOrExit(mSaveTask != 0);
+
+    mTaskRunner.Cancel(mSaveTask);
+    mSaveTask = 0;
+
+    // Posted to the worker so that it is written after any write in progress.
+    snapshot = std::make_shared<AdvertisingSnapshot>(mSnapshot);
+    mWorkerPool.Post([snapshot, &saved]() {
+        snapshot->Save();
+        saved.set_value();
+    });
+    saved.get_future().wait();
+
+exit:
+    return;
+}
+
+void AdvertisingRestorer::Reconcile(const std::string &aName, const AdvertisingSnapshot::Host *aHost)
+{
+    const AdvertisingSnapshot::Host *restoredHost = mSnapshot.FindHost(aName);
+
+    // The live registration supersedes the restored host, whose services not registered again are stale.
+    if (restoredHost != nullptr && mRestoredHosts.erase(aName) > 0)
+    {
+        otbrLogInfo("Restored SRP host '%s' registered again", aName.c_str());
+        UnpublishStaleServices(*restoredHost, aHost);
+    }
+}
+
+void AdvertisingRestorer::UnpublishStaleServices(const AdvertisingSnapshot::Host &aRestoredHost,
+                                                 const AdvertisingSnapshot::Host *aHost)
+{
+    for (const AdvertisingSnapshot::Service &service : aRestoredHost.mServices)
+    {
+        std::string instanceName = service.mInstanceName;
+
+        if (aHost != nullptr &&
+            std::any_of(aHost->mServices.begin(), aHost->mServices.end(),
+                        [&service](const AdvertisingSnapshot::Service &aService) {
+                            return aService.mInstanceName == service.mInstanceName && aService.mType == service.mType;
+                        }))
+        {
+            continue;
+        }
+
+        otbrLogDebug("Unpublish stale SRP service '%s'", instanceName.c_str());
+        mPublisher.UnpublishService(service.mInstanceName, service.mType, [instanceName](otbrError aError) {
+            // Treat `NOT_FOUND` as success when unpublishing service
+            aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
+            otbrLogResult(aError, "Handle unpublish stale SRP service '%s'", instanceName.c_str());
+        });
+    }
+}
+
+void AdvertisingRestorer::ExpireRestoredHosts(void)
+{
+    auto now            = AdvertisingSnapshot::WallClock::now();
+    auto nextExpireTime = AdvertisingSnapshot::WallClock::time_point::max();
+    bool expired        = false;
+
+    mTaskRunner.Cancel(mExpiryTask);
+    mExpiryTask = 0;
+
+    for (auto iter = mRestoredHosts.begin(); iter != mRestoredHosts.end();)
+    {
+        const AdvertisingSnapshot::Host *host     = mSnapshot.FindHost(*iter);
+        std::string                      hostName = *iter;
+
+        if (host->mExpireTime > now)
+        {
+            nextExpireTime = std::min(nextExpireTime, host->mExpireTime);
+            ++iter;
+            continue;
+        }
+
+        otbrLogInfo("Lease of restored SRP host '%s' expired", hostName.c_str());
+        UnpublishStaleServices(*host, nullptr);
+        mPublisher.UnpublishHost(hostName, [hostName](otbrError aError) {
+            // Treat `NOT_FOUND` as success when unpublishing host.
+            aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
+            otbrLogResult(aError, "Handle unpublish restored SRP host '%s'", hostName.c_str());
+        });
+        mSnapshot.RemoveHost(hostName);
+        iter    = mRestoredHosts.erase(iter);
+        expired = true;
+    }
+
+    if (!mRestoredHosts.empty())
+    {
+        Milliseconds delay = std::chrono::duration_cast<Milliseconds>(nextExpireTime - now) + Milliseconds(1);
+
+        mExpiryTask = mTaskRunner.Post(delay, [this]() { ExpireRestoredHosts(); });
+    }
+
+    if (expired)
+    {
+        ScheduleSave();
+    }
+}
+
+void AdvertisingRestorer::ScheduleSave(void)
+{
+    VerifyOrExit(mSnapshot.IsEnabled() && mSaveTask == 0);
+
+    mSaveTask = mTaskRunner.Post(kSaveDelay, [this]() {
+        // The file is written on the worker thread with a copy of the snapshot, so the mainloop is not blocked.
+        std::shared_ptr<AdvertisingSnapshot> snapshot = std::make_shared<AdvertisingSnapshot>(mSnapshot);
+
+        mSaveTask = 0;
+        mWorkerPool.Post([snapshot]() { snapshot->Save(); });
+    });
+
+exit:
+    return;
+}
+
+} // namespace otbr
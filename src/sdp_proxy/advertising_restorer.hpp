@@ -0,0 +1,148 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for restoring the hosts and services advertised by the Advertising Proxy.
+ */
+
+#ifndef OTBR_SRP_ADVERTISING_RESTORER_HPP_
+#define OTBR_SRP_ADVERTISING_RESTORER_HPP_
+
+#include <set>
+#include <string>
+
+#include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/worker_pool.hpp"
+#include "mdns/mdns.hpp"
+#include "sdp_proxy/advertising_snapshot.hpp"
+
+namespace otbr {
+
+/**
+ * This class restores the hosts and services of an advertising snapshot, and keeps the snapshot in sync with the
+ * live SRP registrations.
+ *
+ * A restored host is published until its SRP client registers again, and is unpublished when its lease expires.
+ * The changes of the snapshot are coalesced and written to the file on a worker thread.
+ *
+ */
+class AdvertisingRestorer : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the restorer without a snapshot file.
+     *
+     * @param[in] aPublisher  A reference to the mDNS publisher.
+     *
+     */
+    explicit AdvertisingRestorer(Mdns::Publisher &aPublisher);
+
+    /**
+     * This destructor writes the pending changes of the snapshot to the file.
+     *
+     */
+    ~AdvertisingRestorer(void);
+
+    /**
+     * This method sets the snapshot file, and restores the hosts and services in the file.
+     *
+     * @param[in] aPath  The path of the snapshot file.
+     *
+     */
+    void Load(const std::string &aPath);
+
+    /**
+     * This method publishes the restored hosts which have not registered again.
+     *
+     */
+    void PublishRestoredHosts(void);
+
+    /**
+     * This method updates a host registered on the SRP server.
+     *
+     * The services of a restored host which are not registered again are unpublished.
+     *
+     * @param[in] aHost  The host with all its registered services.
+     *
+     */
+    void UpdateHost(AdvertisingSnapshot::Host aHost);
+
+    /**
+     * This method removes a host which is deleted from the SRP server.
+     *
+     * @param[in] aName  The host name.
+     *
+     */
+    void RemoveHost(const std::string &aName);
+
+    /**
+     * This method writes the pending changes of the snapshot to the file, and waits for the write.
+     *
+     */
+    void Flush(void);
+
+    /**
+     * This method returns whether a host is restored and has not registered again.
+     *
+     * @param[in] aName  The host name.
+     *
+     */
+    bool IsRestored(const std::string &aName) const { return mRestoredHosts.count(aName) > 0; }
+
+    /**
+     * This method returns the snapshot.
+     *
+     */
+    const AdvertisingSnapshot &GetSnapshot(void) const { return mSnapshot; }
+
+private:
+    void Reconcile(const std::string &aName, const AdvertisingSnapshot::Host *aHost);
+    void UnpublishStaleServices(const AdvertisingSnapshot::Host &aRestoredHost, const AdvertisingSnapshot::Host *aHost);
+    void ExpireRestoredHosts(void);
+    void ScheduleSave(void);
+
+    // A reference to the mDNS publisher, has no ownership.
+    Mdns::Publisher &mPublisher;
+
+    TaskRunner mTaskRunner;
+
+    // The advertised hosts and services, and the names of the restored hosts which have not registered again.
+    AdvertisingSnapshot   mSnapshot;
+    std::set<std::string> mRestoredHosts;
+    TaskRunner::TaskId    mExpiryTask = 0;
+    TaskRunner::TaskId    mSaveTask   = 0;
+
+    // The snapshot file is written by the worker, which is destroyed first.
+    WorkerPool mWorkerPool;
+};
+
+} // namespace otbr
+
+#endif // OTBR_SRP_ADVERTISING_RESTORER_HPP_
@@ -0,0 +1,406 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   The file implements the snapshot of the hosts and services advertised by the Advertising Proxy.
+ */
+
+#define OTBR_LOG_TAG "ADPROXY"
+
+#include "sdp_proxy/advertising_snapshot.hpp"
+
+#include <fstream>
+#include <iterator>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace {
+
+// The file starts with the magic and version, and ends with a checksum of everything before it.
+constexpr char    kMagic[]      = {'O', 'T', 'B', 'R', 'A', 'D', 'V'};
+constexpr uint8_t kVersion      = 1;
+constexpr size_t  kChecksumSize = sizeof(uint32_t);
+
+std::string GetDirectory(const std::string &aPath)
+{
+    size_t pos = aPath.rfind('/');
+
+    return pos == std::string::npos ? "." : (pos == 0 ? "/" : aPath.substr(0, pos));
+}
+
+uint32_t Checksum(const uint8_t *aData, size_t aLength)
+{
+    constexpr uint32_t kFnvPrime = 16777619u;
+    uint32_t           hash      = 2166136261u;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        hash = (hash ^ aData[i]) * kFnvPrime;
+    }
+
+    return hash;
+}
+
+class Writer
+{
+public:
+    void WriteUint8(uint8_t aValue) { mBuffer.push_back(aValue); }
+
+    void WriteUint16(uint16_t aValue)
+    {
+        WriteUint8(static_cast<uint8_t>(aValue >> 8));
+        WriteUint8(static_cast<uint8_t>(aValue & 0xff));
+    }
+
+    void WriteUint32(uint32_t aValue)
+    {
+        WriteUint16(static_cast<uint16_t>(aValue >> 16));
+        WriteUint16(static_cast<uint16_t>(aValue & 0xffff));
+    }
+
+    void WriteUint64(uint64_t aValue)
+    {
+        WriteUint32(static_cast<uint32_t>(aValue >> 32));
+        WriteUint32(static_cast<uint32_t>(aValue & 0xffffffff));
+    }
+
+    void WriteBytes(const uint8_t *aBytes, size_t aLength) { mBuffer.insert(mBuffer.end(), aBytes, aBytes + aLength); }
+
+    void WriteString(const std::string &aString)
+    {
+        WriteUint16(static_cast<uint16_t>(aString.size()));
+        WriteBytes(reinterpret_cast<const uint8_t *>(aString.data()), aString.size());
+    }
+
+    std::vector<uint8_t> &GetBuffer(void) { return mBuffer; }
+
+private:
+    std::vector<uint8_t> mBuffer;
+};
+
+class Reader
+{
+public:
+    Reader(const uint8_t *aData, size_t aLength)
+        : mCur(aData)
+        , mEnd(aData + aLength)
+    {
+    }
+
+    bool ReadUint8(uint8_t &aValue)
+    {
+        bool ok = (mCur < mEnd);
+
+        if (ok)
+        {
+            aValue = *mCur++;
+        }
+
+        return ok;
+    }
+
+    bool ReadUint16(uint16_t &aValue)
+    {
+        uint8_t high = 0, low = 0;
+        bool    ok = ReadUint8(high) && ReadUint8(low);
+
+        aValue = static_cast<uint16_t>((high << 8) | low);
+        return ok;
+    }
+
+    bool ReadUint32(uint32_t &aValue)
+    {
+        uint16_t high = 0, low = 0;
+        bool     ok = ReadUint16(high) && ReadUint16(low);
+
+        aValue = (static_cast<uint32_t>(high) << 16) | low;
+        return ok;
+    }
+
+    bool ReadUint64(uint64_t &aValue)
+    {
+        uint32_t high = 0, low = 0;
+        bool     ok = ReadUint32(high) && ReadUint32(low);
+
+        aValue = (static_cast<uint64_t>(high) << 32) | low;
+        return ok;
+    }
+
+    bool ReadBytes(uint8_t *aBytes, size_t aLength)
+    {
+        bool ok = (static_cast<size_t>(mEnd - mCur) >= aLength);
+
+        if (ok)
+        {
+            memcpy(aBytes, mCur, aLength);
+            mCur += aLength;
+        }
+
+        return ok;
+    }
+
+    bool ReadString(std::string &aString)
+    {
+        uint16_t length = 0;
+        bool     ok     = ReadUint16(length) && static_cast<size_t>(mEnd - mCur) >= length;
+
+        if (ok)
+        {
+            aString.assign(reinterpret_cast<const char *>(mCur), length);
+            mCur += length;
+        }
+
+        return ok;
+    }
+
+    bool IsEnd(void) const { return mCur == mEnd; }
+
+private:
+    const uint8_t *mCur;
+    const uint8_t *mEnd;
+};
+
+void WriteHost(Writer &aWriter, const AdvertisingSnapshot::Host &aHost)
+{
+    aWriter.WriteString(aHost.mName);
+    aWriter.WriteUint64(static_cast<uint64_t>(
+        std::chrono::duration_cast<Seconds>(aHost.mExpireTime.time_since_epoch()).count()));
+
+    aWriter.WriteUint8(static_cast<uint8_t>(aHost.mAddresses.size()));
+    for (const Ip6Address &address : aHost.mAddresses)
+    {
+        aWriter.WriteBytes(address.m8, sizeof(address.m8));
+    }
+
+    aWriter.WriteUint16(static_cast<uint16_t>(aHost.mServices.size()));
+    for (const AdvertisingSnapshot::Service &service : aHost.mServices)
+    {
+        aWriter.WriteString(service.mInstanceName);
+        aWriter.WriteString(service.mType);
+        aWriter.WriteUint8(static_cast<uint8_t>(service.mSubTypes.size()));
+        for (const std::string &subType : service.mSubTypes)
+        {
+            aWriter.WriteString(subType);
+        }
+        aWriter.WriteUint16(service.mPort);
+        aWriter.WriteUint16(static_cast<uint16_t>(service.mTxtData.size()));
+        aWriter.WriteBytes(service.mTxtData.data(), service.mTxtData.size());
+    }
+}
+
+bool ReadHost(Reader &aReader, AdvertisingSnapshot::Host &aHost)
+{
+    bool     ok;
+    uint64_t expireTime;
+    uint8_t  addressNum;
+    uint16_t serviceNum;
+
+    ok = aReader.ReadString(aHost.mName) && aReader.ReadUint64(expireTime) && aReader.ReadUint8(addressNum);
+    VerifyOrExit(ok);
+    aHost.mExpireTime = AdvertisingSnapshot::WallClock::time_point(Seconds(expireTime));
+
+    aHost.mAddresses.resize(addressNum);
+    for (Ip6Address &address : aHost.mAddresses)
+    {
+        VerifyOrExit(ok = aReader.ReadBytes(address.m8, sizeof(address.m8)));
+    }
+
+    VerifyOrExit(ok = aReader.ReadUint16(serviceNum));
+    aHost.mServices.resize(serviceNum);
+    for (AdvertisingSnapshot::Service &service : aHost.mServices)
+    {
+        uint8_t  subTypeNum;
+        uint16_t txtLength;
+
+        ok = aReader.ReadString(service.mInstanceName) && aReader.ReadString(service.mType) &&
+             aReader.ReadUint8(subTypeNum);
+        VerifyOrExit(ok);
+
+        service.mSubTypes.resize(subTypeNum);
+        for (std::string &subType : service.mSubTypes)
+        {
+            VerifyOrExit(ok = aReader.ReadString(subType));
+        }
+
+        VerifyOrExit(ok = aReader.ReadUint16(service.mPort) && aReader.ReadUint16(txtLength));
+        service.mTxtData.resize(txtLength);
+        VerifyOrExit(ok = aReader.ReadBytes(service.mTxtData.data(), txtLength));
+    }
+
+exit:
+    return ok;
+}
+
+} // namespace
+
+AdvertisingSnapshot::AdvertisingSnapshot(std::string aPath)
+    : mPath(std::move(aPath))
+{
+}
+
+void AdvertisingSnapshot::SetHost(Host aHost)
+{
+    std::string name = aHost.mName;
+
+    mHosts[name] = std::move(aHost);
+}
+
+void AdvertisingSnapshot::RemoveHost(const std::string &aName)
+{
+    mHosts.erase(aName);
+}
+
+const AdvertisingSnapshot::Host *AdvertisingSnapshot::FindHost(const std::string &aName) const
+{
+    auto iter = mHosts.find(aName);
+
+    return iter != mHosts.end() ? &iter->second : nullptr;
+}
+
+otbrError AdvertisingSnapshot::Save(void) const
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    std::string tmpPath = mPath + ".tmp";
+    FILE       *file    = nullptr;
+    int         dirFd   = -1;
+    int         savedErrno;
+    Writer      writer;
+
+    writer.WriteBytes(reinterpret_cast<const uint8_t *>(kMagic), sizeof(kMagic));
+    writer.WriteUint8(kVersion);
+    writer.WriteUint32(static_cast<uint32_t>(mHosts.size()));
+
+    for (const auto &nameAndHost : mHosts)
+    {
+        WriteHost(writer, nameAndHost.second);
+    }
+
+    writer.WriteUint32(Checksum(writer.GetBuffer().data(), writer.GetBuffer().size()));
+
+    VerifyOrExit((file = fopen(tmpPath.c_str(), "wb")) != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fwrite(writer.GetBuffer().data(), 1, writer.GetBuffer().size(), file) == writer.GetBuffer().size(),
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fflush(file) == 0 && fsync(fileno(file)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(rename(tmpPath.c_str(), mPath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+    // The renamed file survives a power failure only once its directory entry is written.
+    VerifyOrExit((dirFd = open(GetDirectory(mPath).c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)) != -1,
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fsync(dirFd) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    // The cleanup may overwrite `errno` of the failure.
+    savedErrno = errno;
+
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    if (dirFd != -1)
+    {
+        close(dirFd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to save the advertising snapshot %s: %s", mPath.c_str(), strerror(savedErrno));
+        remove(tmpPath.c_str());
+    }
+
+    return error;
+}
+
+otbrError AdvertisingSnapshot::Load(WallClock::time_point aNow)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    std::ifstream        file(mPath, std::ios::binary);
+    std::vector<uint8_t> data;
+    HostMap              hosts;
+    char                 magic[sizeof(kMagic)];
+    uint8_t              version;
+    uint32_t             hostNum;
+    uint32_t             checksum;
+
+    VerifyOrExit(file.is_open(), error = (errno == ENOENT) ? OTBR_ERROR_NOT_FOUND : OTBR_ERROR_ERRNO);
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    VerifyOrExit(!file.bad(), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(data.size() >= kChecksumSize, error = OTBR_ERROR_PARSE);
+
+    {
+        Reader checksumReader(data.data() + data.size() - kChecksumSize, kChecksumSize);
+        Reader reader(data.data(), data.size() - kChecksumSize);
+
+        checksumReader.ReadUint32(checksum);
+        VerifyOrExit(checksum == Checksum(data.data(), data.size() - kChecksumSize), error = OTBR_ERROR_PARSE);
+
+        VerifyOrExit(reader.ReadBytes(reinterpret_cast<uint8_t *>(magic), sizeof(magic)) &&
+                         memcmp(magic, kMagic, sizeof(magic)) == 0,
+                     error = OTBR_ERROR_PARSE);
+        VerifyOrExit(reader.ReadUint8(version) && version == kVersion, error = OTBR_ERROR_PARSE);
+        VerifyOrExit(reader.ReadUint32(hostNum), error = OTBR_ERROR_PARSE);
+
+        for (uint32_t i = 0; i < hostNum; i++)
+        {
+            Host host;
+
+            VerifyOrExit(ReadHost(reader, host), error = OTBR_ERROR_PARSE);
+
+            if (host.mExpireTime > aNow)
+            {
+                std::string name = host.mName;
+
+                hosts[name] = std::move(host);
+            }
+        }
+
+        VerifyOrExit(reader.IsEnd(), error = OTBR_ERROR_PARSE);
+    }
+
+    mHosts = std::move(hosts);
+    otbrLogInfo("Loaded %zu hosts from the advertising snapshot %s", mHosts.size(), mPath.c_str());
+
+exit:
+    if (error != OTBR_ERROR_NONE && error != OTBR_ERROR_NOT_FOUND)
+    {
+        otbrLogWarning("Failed to load the advertising snapshot %s: %s", mPath.c_str(), otbrErrorString(error));
+    }
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ *   This file includes definitions for the snapshot of the hosts and services advertised by the Advertising Proxy.
+ */
+
+#ifndef OTBR_SRP_ADVERTISING_SNAPSHOT_HPP_
+#define OTBR_SRP_ADVERTISING_SNAPSHOT_HPP_
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a persistent snapshot of the SRP hosts and services advertised on the infrastructure link.
+ *
+ * The SRP server state is lost when the agent restarts, and the SRP clients do not register again until their
+ * leases are renewed. The snapshot lets a restarted agent advertise the hosts and services right away, and they
+ * are reconciled as the SRP clients register again or their leases expire.
+ *
+ */
+class AdvertisingSnapshot
+{
+public:
+    using WallClock = std::chrono::system_clock;
+
+    /**
+     * This structure represents an advertised service.
+     *
+     */
+    struct Service
+    {
+        std::string              mInstanceName; ///< The service instance name.
+        std::string              mType;         ///< The service type, e.g. "_meshcop._udp".
+        std::vector<std::string> mSubTypes;     ///< The service sub-type labels.
+        uint16_t                 mPort;         ///< The service port.
+        std::vector<uint8_t>     mTxtData;      ///< The encoded TXT data.
+    };
+
+    /**
+     * This structure represents an advertised host and its services.
+     *
+     */
+    struct Host
+    {
+        std::string             mName;       ///< The host name, without the domain.
+        std::vector<Ip6Address> mAddresses;  ///< The advertised addresses.
+        std::vector<Service>    mServices;   ///< The advertised services.
+        WallClock::time_point   mExpireTime; ///< The time the SRP lease of the host expires.
+    };
+
+    using HostMap = std::map<std::string, Host>;
+
+    /**
+     * This constructor initializes an empty snapshot.
+     *
+     * @param[in] aPath  The path of the snapshot file, an empty path disables the persistence.
+     *
+     */
+    explicit AdvertisingSnapshot(std::string aPath = "");
+
+    /**
+     * This method returns whether the snapshot is persisted.
+     *
+     */
+    bool IsEnabled(void) const { return !mPath.empty(); }
+
+    /**
+     * This method sets the path of the snapshot file.
+     *
+     * @param[in] aPath  The path of the snapshot file, an empty path disables the persistence.
+     *
+     */
+    void SetPath(std::string aPath) { mPath = std::move(aPath); }
+
+    /**
+     * This method adds or replaces a host.
+     *
+     * @param[in] aHost  The host.
+     *
+     */
+    void SetHost(Host aHost);
+
+    /**
+     * This method removes a host.
+     *
+     * @param[in] aName  The host name.
+     *
+     */
+    void RemoveHost(const std::string &aName);
+
+    /**
+     * This method finds a host.
+     *
+     * @param[in] aName  The host name.
+     *
+     * @returns A pointer to the host, or nullptr if not found.
+     *
+     */
+    const Host *FindHost(const std::string &aName) const;
+
+    /**
+     * This method returns all the hosts, ordered by name.
+     *
+     */
+    const HostMap &GetHosts(void) const { return mHosts; }
+
+    /**
+     * This method writes the snapshot to the file.
+     *
+     * The file is replaced atomically, so a crash during the write leaves the previous snapshot.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully written the snapshot.
+     * @retval OTBR_ERROR_ERRNO  Failed to write the file.
+     *
+     */
+    otbrError Save(void) const;
+
+    /**
+     * This method reads the snapshot from the file, and drops the hosts whose leases have expired.
+     *
+     * @param[in] aNow  The current time.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully read the snapshot.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no snapshot file.
+     * @retval OTBR_ERROR_PARSE      The snapshot file is corrupted or of another version.
+     * @retval OTBR_ERROR_ERRNO      Failed to read the file.
+     *
+     */
+    otbrError Load(WallClock::time_point aNow = WallClock::now());
+
+private:
+    std::string mPath;
+    HostMap     mHosts;
+};
+
+} // namespace otbr
+
+#endif // OTBR_SRP_ADVERTISING_SNAPSHOT_HPP_
@@ -48,16 +48,10 @@
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
 #include "utils/dns_utils.hpp"
-#include "utils/string_utils.hpp"
 
 namespace otbr {
 namespace Dnssd {
 
-static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string &aLabel2)
-{
-    return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
-}
-
 DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mMdnsPublisher(aPublisher)
@@ -185,36 +179,23 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        std::string      instanceName;
-        std::string      serviceName;
-        std::string      hostName;
-        std::string      domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
+        DnsNameView      nameView;
 
-        switch (type)
-        {
-        case OT_DNSSD_QUERY_TYPE_BROWSE:
-            splitError = SplitFullServiceName(queryName, serviceName, domain);
-            assert(splitError == OTBR_ERROR_NONE);
-            break;
-        case OT_DNSSD_QUERY_TYPE_RESOLVE:
-            splitError = SplitFullServiceInstanceName(queryName, instanceName, serviceName, domain);
-            assert(splitError == OTBR_ERROR_NONE);
-            break;
-        default:
-            splitError = OTBR_ERROR_NOT_FOUND;
-            break;
-        }
-        if (splitError != OTBR_ERROR_NONE)
+        if (type != OT_DNSSD_QUERY_TYPE_BROWSE && type != OT_DNSSD_QUERY_TYPE_RESOLVE)
         {
             continue;
         }
 
-        if (DnsLabelsEqual(serviceName, aType) &&
-            (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
+        // Splits the query name in place, nothing is copied unless the query matches.
+        nameView = SplitFullDnsNameView(queryName);
+        assert(type == OT_DNSSD_QUERY_TYPE_BROWSE ? nameView.IsService() : nameView.IsServiceInstance());
+
+        if (DnsLabelsEqual(nameView.mServiceName, aType) &&
+            (nameView.mInstanceName.empty() || DnsLabelsEqual(nameView.mInstanceName, unescapedInstanceName)))
         {
+            std::string domain             = nameView.mDomain.ToString() + ".";
             std::string serviceFullName    = aType + "." + domain;
             std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
             std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
@@ -256,23 +237,21 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
-        std::string      hostName, domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
-        otbrError        splitError;
-
-        OTBR_UNUSED_VARIABLE(splitError);
+        DnsNameView      nameView;
 
         if (type != OT_DNSSD_QUERY_TYPE_RESOLVE_HOST)
         {
             continue;
         }
-        splitError = SplitFullHostName(queryName, hostName, domain);
-        assert(splitError == OTBR_ERROR_NONE);
 
-        if (DnsLabelsEqual(hostName, aHostName))
+        nameView = SplitFullDnsNameView(queryName);
+        assert(nameView.IsHost());
+
+        if (DnsLabelsEqual(nameView.mHostName, aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            std::string hostFullName = TranslateDomain(resolvedHostName, nameView.mDomain.ToString() + ".");
 
             otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), hostFullName.c_str(), &hostInfo);
         }
@@ -282,13 +261,12 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
 {
     std::string targetName;
-    std::string hostName;
-    std::string domain;
+    DnsNameView nameView = SplitFullDnsNameView(aName);
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(nameView.IsHost(), targetName = aName);
+    VerifyOrExit(DnsLabelsEqual(nameView.mDomain, "local"), targetName = aName);
 
-    targetName = hostName + "." + aTargetDomain;
+    targetName = nameView.mHostName.ToString() + "." + aTargetDomain;
 
 exit:
     otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
@@ -303,10 +281,10 @@ int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) co
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
         char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        DnsNameView queryInfo;
 
         otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+        queryInfo = SplitFullDnsNameView(queryName);
 
         count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
                   DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
@@ -41,6 +41,9 @@ std::string UnescapeInstanceName(const std::string &aName)
     std::string newName;
     auto        nameLen = aName.length();
 
+    // Most instance names have nothing escaped.
+    VerifyOrExit(aName.find('\\') != std::string::npos, newName = aName);
+
     newName.reserve(nameLen);
 
     for (unsigned int i = 0; i < nameLen; i++)
@@ -70,6 +73,7 @@ std::string UnescapeInstanceName(const std::string &aName)
         newName.push_back(c);
     }
 
+exit:
     return newName;
 }
 
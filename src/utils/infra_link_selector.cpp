@@ -37,8 +37,10 @@
 
 #include "utils/infra_link_selector.hpp"
 
+#include <linux/if_addr.h>
 #include <linux/rtnetlink.h>
 #include <net/if.h>
+#include <stdio.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
@@ -58,7 +60,7 @@ bool InfraLinkSelector::LinkInfo::Update(LinkState aState)
 
     VerifyOrExit(changed);
 
-    if (mState == kUpAndRunning && aState != kUpAndRunning)
+    if (mState >= kUpAndRunning && aState < kUpAndRunning)
     {
         mWasUpAndRunning = true;
         mLastRunningTime = Clock::now();
@@ -74,13 +76,16 @@ InfraLinkSelector::InfraLinkSelector(std::vector<const char *> aInfraLinkNames)
 {
     if (mInfraLinkNames.size() >= 2)
     {
-        mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK);
+        mNetlinkSocket = CreateNetLinkRouteSocket(RTMGRP_LINK | RTMGRP_IPV6_IFADDR);
         VerifyOrDie(mNetlinkSocket != -1, "Failed to create netlink socket");
     }
 
+    mInfraLinkInfos.reserve(mInfraLinkNames.size());
+
     for (const char *name : mInfraLinkNames)
     {
-        mInfraLinkInfos[name].Update(QueryInfraLinkState(name));
+        mInfraLinkInfos.emplace_back(name);
+        UpdateLinkInfo(mInfraLinkInfos.back());
     }
 }
 
@@ -104,10 +109,17 @@ const char *InfraLinkSelector::Select(void)
     {
         sel = SelectGeneric();
     }
+    else
+    {
+        // The vendor selection is authoritative, don't re-evaluate until the next link state change.
+        mRequireReselect = false;
+    }
 #else
     sel = SelectGeneric();
 #endif
 
+    mSelectedInfraLink = sel;
+
     return sel;
 }
 
@@ -127,12 +139,13 @@ const char *InfraLinkSelector::SelectGeneric(void)
     // Prefer `mCurrentInfraLink` if it's up and running.
     if (mCurrentInfraLink != nullptr)
     {
-        currentInfraLinkInfo = &mInfraLinkInfos[mCurrentInfraLink];
+        currentInfraLinkInfo = FindLinkInfo(mCurrentInfraLink);
+        assert(currentInfraLinkInfo != nullptr);
 
         otbrLogInfo("\tInfra link %s is in state %s", mCurrentInfraLink,
                     LinkStateToString(currentInfraLinkInfo->mState));
 
-        VerifyOrExit(currentInfraLinkInfo->mState != kUpAndRunning);
+        VerifyOrExit(!currentInfraLinkInfo->IsUpAndRunning());
     }
 
     // Select an infra link with best state.
@@ -140,16 +153,14 @@ const char *InfraLinkSelector::SelectGeneric(void)
         const char                  *bestInfraLink = mCurrentInfraLink;
         InfraLinkSelector::LinkState bestState     = currentInfraLinkState;
 
-        for (const char *name : mInfraLinkNames)
+        for (const LinkInfo &linkInfo : mInfraLinkInfos)
         {
-            if (name != mCurrentInfraLink)
+            if (linkInfo.mName != mCurrentInfraLink)
             {
-                LinkInfo &linkInfo = mInfraLinkInfos[name];
-
-                otbrLogInfo("\tInfra link %s is in state %s", name, LinkStateToString(linkInfo.mState));
+                otbrLogInfo("\tInfra link %s is in state %s", linkInfo.mName, LinkStateToString(linkInfo.mState));
                 if (bestInfraLink == nullptr || linkInfo.mState > bestState)
                 {
-                    bestInfraLink = name;
+                    bestInfraLink = linkInfo.mName;
                     bestState     = linkInfo.mState;
                 }
             }
@@ -158,7 +169,7 @@ const char *InfraLinkSelector::SelectGeneric(void)
         VerifyOrExit(bestInfraLink != mCurrentInfraLink);
 
         // Prefer `mCurrentInfraLink` if no other infra link is up and running
-        VerifyOrExit(mCurrentInfraLink == nullptr || bestState == kUpAndRunning);
+        VerifyOrExit(mCurrentInfraLink == nullptr || bestState >= kUpAndRunning);
 
         // Prefer `mCurrentInfraLink` if it's down for less than `kInfraLinkSelectionDelay`
         if (mCurrentInfraLink != nullptr && currentInfraLinkInfo->mWasUpAndRunning)
@@ -172,7 +183,10 @@ const char *InfraLinkSelector::SelectGeneric(void)
 
                 otbrLogInfo("Infra link %s was running %lldms ago, wait for %lldms to recheck.", mCurrentInfraLink,
                             timeSinceLastRunning.count(), delay.count());
-                mTaskRunner.Post(delay, [this]() { mRequireReselect = true; });
+                mTaskRunner.Post(delay, [this]() {
+                    mRequireReselect = true;
+                    Reselect();
+                });
                 ExitNow();
             }
         }
@@ -222,6 +236,11 @@ InfraLinkSelector::LinkState InfraLinkSelector::QueryInfraLinkState(const char *
 
     state = (ifReq.ifr_flags & IFF_UP) ? ((ifReq.ifr_flags & IFF_RUNNING) ? kUpAndRunning : kUp) : kDown;
 
+    if (state == kUpAndRunning && HasUsableIp6Address(aInfraLinkName))
+    {
+        state = kReady;
+    }
+
 exit:
     if (sock != 0)
     {
@@ -231,98 +250,51 @@ exit:
     return state;
 }
 
-void InfraLinkSelector::Update(MainloopContext &aMainloop)
-{
-    if (mNetlinkSocket != -1)
-    {
-        FD_SET(mNetlinkSocket, &aMainloop.mReadFdSet);
-        aMainloop.mMaxFd = std::max(mNetlinkSocket, aMainloop.mMaxFd);
-    }
-}
-
-void InfraLinkSelector::Process(const MainloopContext &aMainloop)
+bool InfraLinkSelector::HasUsableIp6Address(const char *aInfraLinkName)
 {
-    OTBR_UNUSED_VARIABLE(aMainloop);
+    // getifaddrs() doesn't report address flags, so read them from /proc/net/if_inet6. Each line is:
+    // <address> <ifindex> <prefix length> <scope> <flags> <netif name>
+    static constexpr unsigned int kLinkLocalScope = 0x20;
 
-    if (mNetlinkSocket != -1 && FD_ISSET(mNetlinkSocket, &aMainloop.mReadFdSet))
-    {
-        ReceiveNetLinkMessage();
-    }
-}
+    FILE        *file  = fopen("/proc/net/if_inet6", "r");
+    bool         found = false;
+    char         address[33];
+    char         name[IF_NAMESIZE + 1];
+    unsigned int index, prefixLength, scope, flags;
 
-void InfraLinkSelector::ReceiveNetLinkMessage(void)
-{
-    const size_t kMaxNetLinkBufSize = 8192;
-    ssize_t      len;
-    union
-    {
-        nlmsghdr mHeader;
-        uint8_t  mBuffer[kMaxNetLinkBufSize];
-    } msgBuffer;
-
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
-    if (len < 0)
-    {
-        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
+    VerifyOrExit(file != nullptr, otbrLogWarning("Failed to open /proc/net/if_inet6: %s", strerror(errno)));
 
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
+    while (fscanf(file, "%32s %x %x %x %x %16s", address, &index, &prefixLength, &scope, &flags, name) == 6)
     {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
-        {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
-            break;
-        case NLMSG_ERROR:
+        if (strcmp(name, aInfraLinkName) == 0 && scope != kLinkLocalScope &&
+            !(flags & (IFA_F_TENTATIVE | IFA_F_DADFAILED)))
         {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
-
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
+            found = true;
             break;
         }
     }
 
 exit:
-    return;
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    return found;
 }
 
-void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
+void InfraLinkSelector::UpdateLinkInfo(LinkInfo &aLinkInfo)
 {
-    const char *infraLinkName = nullptr;
-
-    for (const char *name : mInfraLinkNames)
-    {
-        if (aInfraLinkIndex == if_nametoindex(name))
-        {
-            infraLinkName = name;
-            break;
-        }
-    }
+    LinkState prevState = aLinkInfo.mState;
 
-    VerifyOrExit(infraLinkName != nullptr);
+    aLinkInfo.mIndex = if_nametoindex(aLinkInfo.mName);
 
+    if (aLinkInfo.Update(QueryInfraLinkState(aLinkInfo.mName)))
     {
-        LinkInfo &linkInfo  = mInfraLinkInfos[infraLinkName];
-        LinkState prevState = linkInfo.mState;
-
-        if (linkInfo.Update(QueryInfraLinkState(infraLinkName)))
-        {
-            otbrLogInfo("Infra link name %s index %lu state changed: %s -> %s", infraLinkName, aInfraLinkIndex,
-                        LinkStateToString(prevState), LinkStateToString(linkInfo.mState));
-            mRequireReselect = true;
-        }
+        otbrLogInfo("Infra link name %s index %u state changed: %s -> %s", aLinkInfo.mName, aLinkInfo.mIndex,
+                    LinkStateToString(prevState), LinkStateToString(aLinkInfo.mState));
+        mRequireReselect = true;
     }
-exit:
-    return;
 }
 
 const char *InfraLinkSelector::LinkStateToString(LinkState aState)
@@ -343,6 +315,9 @@ const char *InfraLinkSelector::LinkStateToString(LinkState aState)
     case kUpAndRunning:
         str = "UP+RUNNING";
         break;
+    case kReady:
+        str = "UP+RUNNING+ADDR";
+        break;
     }
     return str;
 }
@@ -36,11 +36,13 @@
 
 #if __linux__
 
-#include <assert.h>
-#include <map>
+#include <functional>
 #include <utility>
 #include <vector>
 
+#include <assert.h>
+#include <linux/netlink.h>
+
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
@@ -65,10 +67,21 @@ namespace Utils {
 /**
  * This class implements Infrastructure Link Selector.
  *
+ * The infrastructure links are only re-evaluated when netlink reports a link or address change of a candidate
+ * link, or when a pending selection delay expires.
+ *
  */
 class InfraLinkSelector : public MainloopProcessor, private NonCopyable
 {
 public:
+    /**
+     * This function pointer is called when the selected infrastructure link changes.
+     *
+     * @param[in]  aInfraLinkName  The newly selected infrastructure link.
+     *
+     */
+    using InfraLinkChangedCallback = std::function<void(const char *aInfraLinkName)>;
+
     /**
      * This constructor initializes the InfraLinkSelector instance.
      *
@@ -87,6 +100,7 @@ public:
      * This method selects an infrastructure link among infrastructure link candidates using rules below:
      *
      * The infrastructure link in the most usable state is selected:
+     *      Prefer `up and running with IPv6 address` to `up and running`
      *      Prefer `up and running` to `up`
      *      Prefer `up` to `down`
      *      Prefer `down` to `invalid`
@@ -100,6 +114,17 @@ public:
      */
     const char *Select(void);
 
+    /**
+     * This method sets the callback to be invoked when the selected infrastructure link changes.
+     *
+     * The selection is re-evaluated from the mainloop after netlink events are processed, so the callback
+     * is always invoked from the mainloop.
+     *
+     * @param[in]  aCallback  The callback to receive infrastructure link changed events.
+     *
+     */
+    void SetInfraLinkChangedCallback(InfraLinkChangedCallback aCallback) { mInfraLinkChangedCallback = aCallback; }
+
 private:
     /**
      * This enumeration infrastructure link states.
@@ -110,16 +135,25 @@ private:
         kInvalid,      ///< The infrastructure link is invalid.
         kDown,         ///< The infrastructure link is down.
         kUp,           ///< The infrastructure link is up, but not running.
-        kUpAndRunning, ///< The infrastructure link is up and running.
-
+        kUpAndRunning, ///< The infrastructure link is up and running, but has no usable IPv6 address.
+        kReady,        ///< The infrastructure link is up and running, and has a usable IPv6 address.
     };
 
     struct LinkInfo
     {
+        explicit LinkInfo(const char *aName)
+            : mName(aName)
+        {
+        }
+
+        const char       *mName;
+        uint32_t          mIndex = 0;
         LinkState         mState = kInvalid;
         Clock::time_point mLastRunningTime;
         bool              mWasUpAndRunning = false;
+        bool              mDirty           = false; // Changed by a netlink message, but not re-queried yet.
 
+        bool IsUpAndRunning(void) const { return mState >= kUpAndRunning; }
         bool Update(LinkState aState);
     };
 
@@ -127,20 +161,27 @@ private:
     static constexpr auto        kInfraLinkSelectionDelay = Milliseconds(10000);
 
     const char *SelectGeneric(void);
+    void        Reselect(void);
 
     static const char *LinkStateToString(LinkState aState);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
+    static bool        HasUsableIp6Address(const char *aInfraLinkName);
     void               Update(MainloopContext &aMainloop) override;
     void               Process(const MainloopContext &aMainloop) override;
-    void               ReceiveNetLinkMessage(void);
-    void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
-
-    std::vector<const char *>        mInfraLinkNames;
-    std::map<const char *, LinkInfo> mInfraLinkInfos;
-    int                              mNetlinkSocket    = -1;
-    const char                      *mCurrentInfraLink = nullptr;
-    TaskRunner                       mTaskRunner;
-    bool                             mRequireReselect = true;
+    void               ReceiveNetLinkMessages(void);
+    void               HandleNetLinkMessage(const struct nlmsghdr &aHeader);
+    LinkInfo          *FindLinkInfo(const char *aInfraLinkName);
+    LinkInfo          *FindLinkInfo(uint32_t aInfraLinkIndex);
+    void               UpdateLinkInfo(LinkInfo &aLinkInfo);
+
+    std::vector<const char *> mInfraLinkNames;
+    std::vector<LinkInfo>     mInfraLinkInfos;
+    int                       mNetlinkSocket     = -1;
+    const char               *mCurrentInfraLink  = nullptr;
+    const char               *mSelectedInfraLink = nullptr;
+    TaskRunner                mTaskRunner;
+    bool                      mRequireReselect = true;
+    InfraLinkChangedCallback  mInfraLinkChangedCallback;
 };
 
 } // namespace Utils
@@ -33,12 +33,292 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <mbedtls/aes.h>
+#include <mbedtls/platform_util.h>
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+enum
+{
+    kAesBlockSize    = 16,
+    kCacheSize       = 8,
+    kDigestSize      = 32,
+    kHmacKeySize     = 32,
+    kHmacInnerPad    = 0x36,
+    kHmacOuterPad    = 0x5c,
+    kSha256BlockSize = 64,
+};
+
+/**
+ * This class implements AES-CMAC (RFC 4493), whose AES key schedule and subkeys are computed once and reused for
+ * all the messages.
+ *
+ * The block cipher is mbedtls AES, which uses the AES-NI instructions when they are enabled in mbedtls and supported
+ * by the CPU.
+ *
+ */
+class Cmac
+{
+public:
+    explicit Cmac(const uint8_t *aKey)
+    {
+        uint8_t zero[kAesBlockSize] = {0};
+        uint8_t l[kAesBlockSize];
+
+        mbedtls_aes_init(&mAes);
+        mbedtls_aes_setkey_enc(&mAes, aKey, kAesBlockSize * 8);
+
+        mbedtls_aes_crypt_ecb(&mAes, MBEDTLS_AES_ENCRYPT, zero, l);
+        Double(l, mK1);
+        Double(mK1, mK2);
+        mbedtls_platform_zeroize(l, sizeof(l));
+    }
+
+    ~Cmac(void)
+    {
+        mbedtls_aes_free(&mAes);
+        mbedtls_platform_zeroize(mK1, sizeof(mK1));
+        mbedtls_platform_zeroize(mK2, sizeof(mK2));
+    }
+
+    void Compute(const uint8_t *aMessage, size_t aLength, uint8_t *aMac)
+    {
+        uint8_t block[kAesBlockSize] = {0};
+        size_t  lastLength;
+
+        // All blocks but the last one, which is xored with a subkey.
+        while (aLength > kAesBlockSize)
+        {
+            Xor(block, aMessage, kAesBlockSize);
+            mbedtls_aes_crypt_ecb(&mAes, MBEDTLS_AES_ENCRYPT, block, block);
+            aMessage += kAesBlockSize;
+            aLength -= kAesBlockSize;
+        }
+
+        lastLength = aLength;
+        Xor(block, aMessage, lastLength);
+
+        if (lastLength == kAesBlockSize)
+        {
+            Xor(block, mK1, kAesBlockSize);
+        }
+        else
+        {
+            block[lastLength] ^= 0x80;
+            Xor(block, mK2, kAesBlockSize);
+        }
+
+        mbedtls_aes_crypt_ecb(&mAes, MBEDTLS_AES_ENCRYPT, block, aMac);
+    }
+
+    // The MAC of a single complete block takes only one AES block operation.
+    void ComputeBlock(const uint8_t *aBlock, uint8_t *aMac)
+    {
+        uint8_t block[kAesBlockSize];
+
+        for (size_t i = 0; i < kAesBlockSize; i++)
+        {
+            block[i] = aBlock[i] ^ mK1[i];
+        }
+
+        mbedtls_aes_crypt_ecb(&mAes, MBEDTLS_AES_ENCRYPT, block, aMac);
+    }
+
+private:
+    static void Xor(uint8_t *aBlock, const uint8_t *aBytes, size_t aLength)
+    {
+        for (size_t i = 0; i < aLength; i++)
+        {
+            aBlock[i] ^= aBytes[i];
+        }
+    }
+
+    static void Double(const uint8_t *aBlock, uint8_t *aResult)
+    {
+        for (size_t i = 0; i < kAesBlockSize - 1; i++)
+        {
+            aResult[i] = static_cast<uint8_t>((aBlock[i] << 1) | (aBlock[i + 1] >> 7));
+        }
+
+        aResult[kAesBlockSize - 1] =
+            static_cast<uint8_t>((aBlock[kAesBlockSize - 1] << 1) ^ ((aBlock[0] & 0x80) ? 0x87 : 0));
+    }
+
+    mbedtls_aes_context mAes;
+    uint8_t             mK1[kAesBlockSize];
+    uint8_t             mK2[kAesBlockSize];
+};
+
+/**
+ * This class caches the recently computed PSKc, keyed by a digest of the passphrase and the salt so that the
+ * passphrases are not kept in memory.
+ *
+ * The digest is an HMAC-SHA256 under a random key generated for each process, so that a digest leaked from memory
+ * can't be used to test guessed passphrases offline.
+ *
+ */
+class PskcCache
+{
+public:
+    PskcCache(void)
+    {
+        std::random_device randomDevice;
+
+        for (uint8_t &byte : mHmacKey)
+        {
+            byte = static_cast<uint8_t>(randomDevice());
+        }
+    }
+
+    ~PskcCache(void) { mbedtls_platform_zeroize(mHmacKey, sizeof(mHmacKey)); }
+
+    void ComputeDigest(const char *aPassphrase, const char *aSalt, uint16_t aSaltLen, uint8_t *aDigest) const
+    {
+        mbedtls_sha256_context sha256;
+        uint8_t                pad[kSha256BlockSize];
+
+        // HMAC (RFC 2104): SHA256((K ^ opad) || SHA256((K ^ ipad) || message)). The terminating NUL of the
+        // passphrase separates it from the salt in the message.
+        mbedtls_sha256_init(&sha256);
+
+        FillPad(kHmacInnerPad, pad);
+        mbedtls_sha256_starts(&sha256, 0);
+        mbedtls_sha256_update(&sha256, pad, sizeof(pad));
+        mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase) + 1);
+        mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aSalt), aSaltLen);
+        mbedtls_sha256_finish(&sha256, aDigest);
+
+        FillPad(kHmacOuterPad, pad);
+        mbedtls_sha256_starts(&sha256, 0);
+        mbedtls_sha256_update(&sha256, pad, sizeof(pad));
+        mbedtls_sha256_update(&sha256, aDigest, kDigestSize);
+        mbedtls_sha256_finish(&sha256, aDigest);
+
+        mbedtls_sha256_free(&sha256);
+        mbedtls_platform_zeroize(pad, sizeof(pad));
+    }
+
+    bool Lookup(const uint8_t *aDigest, uint8_t *aPskc)
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+        bool                        found = false;
+
+        for (Entry &entry : mEntries)
+        {
+            if (entry.mAge != 0 && memcmp(entry.mDigest, aDigest, kDigestSize) == 0)
+            {
+                memcpy(aPskc, entry.mPskc, OT_PSKC_LENGTH);
+                entry.mAge = ++mAge;
+                found      = true;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+    void Add(const uint8_t *aDigest, const uint8_t *aPskc)
+    {
+        std::lock_guard<std::mutex> _(mMutex);
+        auto   isOlder = [](const Entry &aLhs, const Entry &aRhs) { return aLhs.mAge < aRhs.mAge; };
+        Entry *oldest  = std::min_element(mEntries, mEntries + kCacheSize, isOlder);
+
+        memcpy(oldest->mDigest, aDigest, kDigestSize);
+        memcpy(oldest->mPskc, aPskc, OT_PSKC_LENGTH);
+        oldest->mAge = ++mAge;
+    }
+
+private:
+    struct Entry
+    {
+        uint8_t  mDigest[kDigestSize];
+        uint8_t  mPskc[OT_PSKC_LENGTH];
+        uint64_t mAge = 0;
+    };
+
+    // The key is shorter than the SHA256 block, so it is zero padded.
+    void FillPad(uint8_t aPadByte, uint8_t *aPad) const
+    {
+        memset(aPad, aPadByte, kSha256BlockSize);
+
+        for (size_t i = 0; i < kHmacKeySize; i++)
+        {
+            aPad[i] ^= mHmacKey[i];
+        }
+    }
+
+    std::mutex mMutex;
+    Entry      mEntries[kCacheSize];
+    uint64_t   mAge = 0;
+    uint8_t    mHmacKey[kHmacKeySize];
+};
+
+static PskcCache sPskcCache;
+
+// PBKDF2 (RFC 8018) with AES-CMAC-PRF-128 (RFC 4615), which derives the PSKc in its first and only block.
+static void DerivePskc(const char *aSalt, uint16_t aSaltLen, const char *aPassphrase, uint8_t *aPskc)
+{
+    static_assert(OT_PSKC_LENGTH == kAesBlockSize, "PSKc must be a single PRF block");
+
+    const uint8_t *passphrase       = reinterpret_cast<const uint8_t *>(aPassphrase);
+    size_t         passphraseLength = strlen(aPassphrase);
+    uint8_t        key[kAesBlockSize];
+    uint8_t        prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t        prfOutput[kAesBlockSize];
+
+    // AES-CMAC-PRF-128 uses a passphrase of other length than 16 bytes by its AES-CMAC with a zero key.
+    if (passphraseLength == kAesBlockSize)
+    {
+        memcpy(key, passphrase, kAesBlockSize);
+    }
+    else
+    {
+        uint8_t zero[kAesBlockSize] = {0};
+
+        Cmac(zero).Compute(passphrase, passphraseLength, key);
+    }
+
+    {
+        Cmac prf(key);
+
+        // Calculate U_1 with the block counter 1
+        memcpy(prfInput, aSalt, aSaltLen);
+        prfInput[aSaltLen + 0] = 0;
+        prfInput[aSaltLen + 1] = 0;
+        prfInput[aSaltLen + 2] = 0;
+        prfInput[aSaltLen + 3] = 1;
+        prf.Compute(prfInput, aSaltLen + 4, prfOutput);
+        memcpy(aPskc, prfOutput, kAesBlockSize);
+
+        for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
+        {
+            // Calculate U_i
+            prf.ComputeBlock(prfOutput, prfOutput);
+
+            // xor
+            for (uint32_t j = 0; j < kAesBlockSize; j++)
+            {
+                aPskc[j] ^= prfOutput[j];
+            }
+        }
+    }
+
+    mbedtls_platform_zeroize(key, sizeof(key));
+    mbedtls_platform_zeroize(prfOutput, sizeof(prfOutput));
+}
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix = "Thread";
@@ -56,9 +336,9 @@ void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
     memcpy(mSalt + cur, aNetworkName, strlen(aNetworkName));
     cur += strlen(aNetworkName);
 
+exit:
     mSaltLen = static_cast<uint16_t>(cur);
 
-exit:
     if (ret != kPskcStatus_Ok)
     {
         otbrLogErr("ExtPanId or NetworkName is nullptr");
@@ -68,52 +348,50 @@ exit:
 
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    uint8_t digest[kDigestSize];
 
     SetSalt(aExtPanId, aNetworkName);
+    sPskcCache.ComputeDigest(aPassphrase, mSalt, mSaltLen, digest);
 
-    while (keyLen)
+    if (!sPskcCache.Lookup(digest, mPskc))
     {
-        memcpy(prfInput, mSalt, mSaltLen);
+        DerivePskc(mSalt, mSaltLen, aPassphrase, mPskc);
+        sPskcCache.Add(digest, mPskc);
+    }
 
-        blockCounter++;
-        prfInput[mSaltLen + 0] = (uint8_t)(blockCounter >> 24);
-        prfInput[mSaltLen + 1] = (uint8_t)(blockCounter >> 16);
-        prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
-        prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
-        // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
-        memcpy(keyBlock, prfOutput, prfBlockLen);
+    return mPskc;
+}
 
-        for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
-        {
-            memcpy(prfInput, prfOutput, prfBlockLen);
+void Pskc::ComputePskcs(const Params *aParams, size_t aCount, uint8_t *aPskcs)
+{
+    std::atomic<size_t>      next(0);
+    std::vector<std::thread> workers;
+    size_t                   numWorkers = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), aCount);
 
-            // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+    auto work = [&]() {
+        Pskc pskc;
 
-            // xor
-            for (uint32_t j = 0; j < prfBlockLen; j++)
-            {
-                keyBlock[j] ^= prfOutput[j];
-            }
+        for (size_t i = next++; i < aCount; i = next++)
+        {
+            const Params &params = aParams[i];
+
+            memcpy(&aPskcs[i * OT_PSKC_LENGTH],
+                   pskc.ComputePskc(params.mExtPanId, params.mNetworkName, params.mPassphrase), OT_PSKC_LENGTH);
         }
+    };
 
-        useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
-        memcpy(pskc, keyBlock, useLen);
-        pskc += useLen;
-        keyLen -= useLen;
+    // The calling thread is one of the workers.
+    for (size_t i = 1; i < numWorkers; i++)
+    {
+        workers.emplace_back(work);
+    }
+
+    work();
+
+    for (std::thread &worker : workers)
+    {
+        worker.join();
     }
-    return mPskc;
 }
 
 } // namespace Psk
@@ -42,11 +42,10 @@
 #define OT_PBKDF2_SALT_MAX_LENGTH 30
 #define OT_PSKC_LENGTH 16
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
-#include <mbedtls/cmac.h>
-
 namespace otbr {
 namespace Psk {
 
@@ -59,6 +58,17 @@ enum
 class Pskc
 {
 public:
+    /**
+     * This structure represents the inputs of a PSKc.
+     *
+     */
+    struct Params
+    {
+        const uint8_t *mExtPanId;    ///< A pointer to extended PAN ID.
+        const char    *mNetworkName; ///< A pointer to network name.
+        const char    *mPassphrase;  ///< A pointer to passphrase.
+    };
+
     /**
      * This method computes the PSKc.
      *
@@ -71,6 +81,16 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
+    /**
+     * This method computes the PSKc of many networks in parallel on the available cores.
+     *
+     * @param[in]  aParams  A pointer to the inputs of the PSKc.
+     * @param[in]  aCount   The number of PSKc to compute.
+     * @param[out] aPskcs   A pointer to the buffer to store the @p aCount PSKc one after another.
+     *
+     */
+    static void ComputePskcs(const Params *aParams, size_t aCount, uint8_t *aPskcs);
+
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
 
@@ -36,9 +36,11 @@ namespace otbr {
 
 namespace StringUtils {
 
-bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2)
+bool EqualCaseInsensitive(StringView aString1, StringView aString2)
 {
-    return ToLowercase(aString1) == ToLowercase(aString2);
+    return aString1.size() == aString2.size() &&
+           std::equal(aString1.begin(), aString1.end(), aString2.begin(),
+                      [](char aChar1, char aChar2) { return std::tolower(aChar1) == std::tolower(aChar2); });
 }
 
 std::string ToLowercase(const std::string &aString)
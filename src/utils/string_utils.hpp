@@ -39,12 +39,14 @@
 #include <string.h>
 #include <string>
 
+#include "common/string_view.hpp"
+
 namespace otbr {
 
 namespace StringUtils {
 
 /**
- * This function compares two strings in a case-insensitive manner.
+ * This function compares two strings in a case-insensitive manner without allocating memory.
  *
  * @param[in] aString1 The first string.
  * @param[in] aString2 The second string.
@@ -52,7 +54,7 @@ namespace StringUtils {
  * @returns  Whether the two strings are equal in a case-insensitive manner.
  *
  */
-bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2);
+bool EqualCaseInsensitive(StringView aString1, StringView aString2);
 
 /**
  * This function converts a given string to lowercase.
@@ -74,6 +74,7 @@ exit:
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInstance(aInstance)
     , mNcp(aNcp)
+    , mTopologyModel(aInstance)
 {
 }
 
@@ -127,6 +128,8 @@ void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
     {
         ActiveDatasetChangedCallback();
     }
+
+    mTopologyModel.HandleStateChanged(aFlags);
 }
 
 void ThreadHelper::ActiveDatasetChangedCallback()
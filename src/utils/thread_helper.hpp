@@ -48,6 +48,8 @@
 #include <openthread/netdata.h>
 #include <openthread/thread.h>
 
+#include "utils/topology_model.hpp"
+
 namespace otbr {
 namespace Ncp {
 class ControllerOpenThread;
@@ -219,6 +221,14 @@ public:
      */
     otInstance *GetInstance(void) { return mInstance; }
 
+    /**
+     * This method returns the Thread network topology model.
+     *
+     * @returns The topology model.
+     *
+     */
+    TopologyModel &GetTopologyModel(void) { return mTopologyModel; }
+
     /**
      * This method handles OpenThread state changed notification.
      *
@@ -304,6 +314,8 @@ private:
 
     std::random_device mRandomDevice;
 
+    TopologyModel mTopologyModel;
+
 #if OTBR_ENABLE_DBUS_SERVER
     UpdateMeshCopTxtHandler mUpdateMeshCopTxtHandler;
 #endif
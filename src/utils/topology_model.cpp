@@ -0,0 +1,346 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/topology_model.hpp"
+
+#include <algorithm>
+
+#include <openthread/link.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace agent {
+
+// MulticastAddr
+static const char *kMulticastAddrAllRouters = "ff03::2";
+
+// Default TlvTypes for Diagnostic inforamtion
+static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
+
+// The delay before refreshing the model after the partition changes, which lets the router table settle
+static constexpr Milliseconds kStateChangedRefreshDelay = Milliseconds(2000);
+
+// The number of refresh intervals a node is kept without being heard
+static constexpr uint32_t kNodeExpireRefreshCount = 3;
+
+// The bit offset of the Router ID in a RLOC16
+static constexpr uint8_t kRouterIdOffset = 10;
+
+// The mask of the Child ID in a RLOC16
+static constexpr uint16_t kChildIdMask = 0x1ff;
+
+constexpr Milliseconds TopologyModel::kDefaultRefreshInterval;
+constexpr uint16_t     TopologyModel::kUnknownRloc16;
+
+TopologyModel::TopologyModel(otInstance *aInstance)
+    : mInstance(aInstance)
+    , mRefreshInterval(kDefaultRefreshInterval)
+    , mRefreshTaskId(0)
+    , mVersion(0)
+{
+    ScheduleRefresh(mRefreshInterval);
+}
+
+void TopologyModel::SetRefreshInterval(Milliseconds aInterval)
+{
+    mRefreshInterval = aInterval;
+    ScheduleRefresh(mRefreshInterval);
+}
+
+void TopologyModel::AddDiagnosticHandler(DiagnosticHandler aHandler)
+{
+    mDiagnosticHandlers.push_back(std::move(aHandler));
+}
+
+otbrError TopologyModel::SendQuery(void)
+{
+    otbrError    error       = OTBR_ERROR_NONE;
+    otIp6Address rlocAddress = *otThreadGetRloc(mInstance);
+    otIp6Address multicastAddress;
+
+    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rlocAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
+                                           &TopologyModel::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
+                                           &TopologyModel::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_OPENTHREAD);
+
+exit:
+    return error;
+}
+
+void TopologyModel::HandleStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID))
+    {
+        // The nodes of the previous partition are not reachable anymore.
+        Clear();
+
+        if (IsAttached())
+        {
+            UpdateLocalChildren();
+            ScheduleRefresh(kStateChangedRefreshDelay);
+        }
+    }
+    else if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED))
+    {
+        UpdateLocalChildren();
+    }
+}
+
+void TopologyModel::ScheduleRefresh(Milliseconds aDelay)
+{
+    if (mRefreshTaskId != 0)
+    {
+        mTaskRunner.Cancel(mRefreshTaskId);
+        mRefreshTaskId = 0;
+    }
+
+    VerifyOrExit(mRefreshInterval != Milliseconds::zero());
+
+    mRefreshTaskId = mTaskRunner.Post(aDelay, [this]() {
+        mRefreshTaskId = 0;
+        Refresh();
+    });
+
+exit:
+    return;
+}
+
+void TopologyModel::Refresh(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    RemoveOutdatedNodes();
+
+    VerifyOrExit(IsAttached());
+    error = SendQuery();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to refresh the topology: %s", otbrErrorString(error));
+    }
+
+    ScheduleRefresh(mRefreshInterval);
+}
+
+void TopologyModel::DiagnosticResponseHandler(otError              aError,
+                                              otMessage           *aMessage,
+                                              const otMessageInfo *aMessageInfo,
+                                              void                *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aMessageInfo);
+
+    static_cast<TopologyModel *>(aContext)->DiagnosticResponseHandler(aError, aMessage);
+}
+
+void TopologyModel::DiagnosticResponseHandler(otError aError, const otMessage *aMessage)
+{
+    std::vector<otNetworkDiagTlv> tlvs;
+    otNetworkDiagTlv              tlv;
+    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    uint16_t                      rloc16   = kUnknownRloc16;
+
+    SuccessOrExit(aError);
+
+    while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &tlv) == OT_ERROR_NONE)
+    {
+        if (tlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        {
+            rloc16 = tlv.mData.mAddr16;
+        }
+        tlvs.push_back(tlv);
+    }
+
+    if (rloc16 != kUnknownRloc16)
+    {
+        UpdateNode(rloc16, tlvs);
+    }
+
+    for (const auto &handler : mDiagnosticHandlers)
+    {
+        handler(rloc16, tlvs);
+    }
+
+exit:
+    if (aError != OT_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to get diagnostic data: %s", otThreadErrorToString(aError));
+    }
+}
+
+void TopologyModel::UpdateNode(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs)
+{
+    Node &node = mNodes[aRloc16];
+
+    node.mRloc16 = aRloc16;
+
+    for (const otNetworkDiagTlv &tlv : aTlvs)
+    {
+        switch (tlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+            node.mExtAddress = tlv.mData.mExtAddress;
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            node.mMode = tlv.mData.mMode;
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            node.mRoutes.clear();
+            for (uint16_t i = 0; i < tlv.mData.mRoute.mRouteCount; ++i)
+            {
+                const otNetworkDiagRouteData &routeData = tlv.mData.mRoute.mRouteData[i];
+
+                node.mRoutes.push_back({static_cast<uint16_t>(routeData.mRouterId << kRouterIdOffset),
+                                        routeData.mLinkQualityIn, routeData.mLinkQualityOut, routeData.mRouteCost});
+            }
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            node.mChildren.clear();
+            for (uint16_t i = 0; i < tlv.mData.mChildTable.mCount; ++i)
+            {
+                const otNetworkDiagChildEntry &childEntry = tlv.mData.mChildTable.mTable[i];
+
+                // The timeout of a child entry is encoded as 2^(Timeout - 4) seconds.
+                node.mChildren.push_back({static_cast<uint16_t>(aRloc16 | childEntry.mChildId),
+                                          (1u << childEntry.mTimeout) >> 4, childEntry.mMode});
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    node.mUpdateTime = Clock::now();
+    ++mVersion;
+}
+
+void TopologyModel::UpdateLocalChildren(void)
+{
+    otDeviceRole role = otThreadGetDeviceRole(mInstance);
+    uint16_t     rloc16;
+    otChildInfo  childInfo;
+
+    VerifyOrExit(role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+
+    rloc16 = otThreadGetRloc16(mInstance);
+
+    {
+        Node &node = mNodes[rloc16];
+
+        node.mRloc16     = rloc16;
+        node.mExtAddress = *otLinkGetExtendedAddress(mInstance);
+        node.mMode       = otThreadGetLinkMode(mInstance);
+        node.mChildren.clear();
+
+        for (uint16_t index = 0; otThreadGetChildInfoByIndex(mInstance, index, &childInfo) == OT_ERROR_NONE; ++index)
+        {
+            otLinkModeConfig mode;
+
+            mode.mRxOnWhenIdle = childInfo.mRxOnWhenIdle;
+            mode.mDeviceType   = childInfo.mFullThreadDevice;
+            mode.mNetworkData  = childInfo.mFullNetworkData;
+            node.mChildren.push_back({childInfo.mRloc16, childInfo.mTimeout, mode});
+        }
+
+        node.mUpdateTime = Clock::now();
+    }
+
+    ++mVersion;
+
+exit:
+    return;
+}
+
+void TopologyModel::RemoveOutdatedNodes(void)
+{
+    Timepoint    now          = Clock::now();
+    otDeviceRole role         = otThreadGetDeviceRole(mInstance);
+    bool         isRouter     = (role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER);
+    Milliseconds expireTime   = mRefreshInterval * kNodeExpireRefreshCount;
+    size_t       oldNodeCount = mNodes.size();
+    otRouterInfo routerInfo;
+
+    for (auto it = mNodes.begin(); it != mNodes.end();)
+    {
+        uint16_t rloc16    = it->first;
+        bool     isExpired = (expireTime != Milliseconds::zero() && now - it->second.mUpdateTime >= expireTime);
+
+        // A router whose Router ID is released by the leader has left the network.
+        if (isRouter && (rloc16 & kChildIdMask) == 0 &&
+            otThreadGetRouterInfo(mInstance, rloc16, &routerInfo) != OT_ERROR_NONE)
+        {
+            isExpired = true;
+        }
+
+        if (isExpired)
+        {
+            it = mNodes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (mNodes.size() != oldNodeCount)
+    {
+        ++mVersion;
+    }
+}
+
+void TopologyModel::Clear(void)
+{
+    if (!mNodes.empty())
+    {
+        mNodes.clear();
+        ++mVersion;
+    }
+}
+
+bool TopologyModel::IsAttached(void) const
+{
+    otDeviceRole role = otThreadGetDeviceRole(mInstance);
+
+    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+}
+
+} // namespace agent
+} // namespace otbr
@@ -0,0 +1,222 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Thread network topology model.
+ */
+
+#ifndef OTBR_UTILS_TOPOLOGY_MODEL_HPP_
+#define OTBR_UTILS_TOPOLOGY_MODEL_HPP_
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <openthread/instance.h>
+#include <openthread/netdiag.h>
+#include <openthread/thread.h>
+
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace agent {
+
+/**
+ * This class implements an in-memory model of the Thread network topology.
+ *
+ * The model is refreshed by a network diagnostic query sent at a configurable interval, and is
+ * updated incrementally by every diagnostic response and by the local state changes. Reading
+ * the model never triggers mesh traffic.
+ *
+ */
+class TopologyModel
+{
+public:
+    static constexpr Milliseconds kDefaultRefreshInterval = Milliseconds(60000);
+    static constexpr uint16_t     kUnknownRloc16          = 0xfffe; ///< The RLOC16 of a node without Short Address.
+
+    /**
+     * This structure represents the route from a router to another router.
+     *
+     */
+    struct Route
+    {
+        uint16_t mRouterRloc16;   ///< The RLOC16 of the destination router.
+        uint8_t  mLinkQualityIn;  ///< The incoming link quality, 0 if there is no direct link.
+        uint8_t  mLinkQualityOut; ///< The outgoing link quality, 0 if there is no direct link.
+        uint8_t  mRouteCost;      ///< The route cost.
+    };
+
+    /**
+     * This structure represents a child of a router.
+     *
+     */
+    struct Child
+    {
+        uint16_t         mRloc16;  ///< The RLOC16 of the child.
+        uint32_t         mTimeout; ///< The child timeout in seconds.
+        otLinkModeConfig mMode;    ///< The link mode of the child.
+    };
+
+    /**
+     * This structure represents a node of the Thread network.
+     *
+     */
+    struct Node
+    {
+        uint16_t           mRloc16;     ///< The RLOC16 of the node.
+        otExtAddress       mExtAddress; ///< The extended address of the node.
+        otLinkModeConfig   mMode;       ///< The link mode of the node.
+        std::vector<Route> mRoutes;     ///< The routes to the other routers.
+        std::vector<Child> mChildren;   ///< The children of the node.
+        Timepoint          mUpdateTime; ///< The time when the node is updated.
+    };
+
+    /**
+     * This structure represents a copy of the model, which can be read off the mainloop.
+     *
+     */
+    struct Snapshot
+    {
+        uint32_t                 mVersion;         ///< The version of the model.
+        Milliseconds             mRefreshInterval; ///< The interval of the background refresh.
+        std::map<uint16_t, Node> mNodes;           ///< The nodes, keyed by RLOC16.
+    };
+
+    using DiagnosticHandler = std::function<void(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs)>;
+
+    /**
+     * The constructor of the topology model.
+     *
+     * @param[in] aInstance  The OpenThread instance.
+     *
+     */
+    explicit TopologyModel(otInstance *aInstance);
+
+    /**
+     * This method sets the interval of the background refresh.
+     *
+     * @param[in] aInterval  The refresh interval, zero to disable the background refresh.
+     *
+     */
+    void SetRefreshInterval(Milliseconds aInterval);
+
+    /**
+     * This method returns the interval of the background refresh.
+     *
+     * @returns The refresh interval.
+     *
+     */
+    Milliseconds GetRefreshInterval(void) const { return mRefreshInterval; }
+
+    /**
+     * This method adds a handler of the network diagnostic responses.
+     *
+     * The handler receives the responses of all the queries sent by `SendQuery()`, including the
+     * background refresh.
+     *
+     * @param[in] aHandler  The diagnostic handler.
+     *
+     */
+    void AddDiagnosticHandler(DiagnosticHandler aHandler);
+
+    /**
+     * This method sends a network diagnostic query to this node and all the routers.
+     *
+     * All the diagnostic queries of the agent should be sent by this method, because OpenThread
+     * delivers the responses only to the handler of the latest query.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully sent the query.
+     * @retval OTBR_ERROR_OPENTHREAD    Failed to send the query.
+     *
+     */
+    otbrError SendQuery(void);
+
+    /**
+     * This method returns the nodes of the model.
+     *
+     * @returns The nodes, keyed by RLOC16.
+     *
+     */
+    const std::map<uint16_t, Node> &GetNodes(void) const { return mNodes; }
+
+    /**
+     * This method returns the version of the model, which is increased on every change.
+     *
+     * @returns The version of the model.
+     *
+     */
+    uint32_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * This method returns a copy of the model.
+     *
+     * @returns A snapshot of the model.
+     *
+     */
+    Snapshot GetSnapshot(void) const { return Snapshot{mVersion, mRefreshInterval, mNodes}; }
+
+    /**
+     * This method handles OpenThread state changed notification.
+     *
+     * @param[in] aFlags  A bit-field indicating specific state that has changed. See `OT_CHANGED_*` definitions.
+     *
+     */
+    void HandleStateChanged(otChangedFlags aFlags);
+
+private:
+    static void DiagnosticResponseHandler(otError              aError,
+                                          otMessage           *aMessage,
+                                          const otMessageInfo *aMessageInfo,
+                                          void                *aContext);
+    void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage);
+
+    void ScheduleRefresh(Milliseconds aDelay);
+    void Refresh(void);
+    void UpdateNode(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs);
+    void UpdateLocalChildren(void);
+    void RemoveOutdatedNodes(void);
+    void Clear(void);
+    bool IsAttached(void) const;
+
+    otInstance                    *mInstance;
+    Milliseconds                   mRefreshInterval;
+    TaskRunner                     mTaskRunner;
+    TaskRunner::TaskId             mRefreshTaskId;
+    std::vector<DiagnosticHandler> mDiagnosticHandlers;
+    std::map<uint16_t, Node>       mNodes;
+    uint32_t                       mVersion;
+};
+
+} // namespace agent
+} // namespace otbr
+
+#endif // OTBR_UTILS_TOPOLOGY_MODEL_HPP_
@@ -32,6 +32,8 @@
 
 #include <openthread/platform/toolchain.h>
 
+#include <algorithm>
+
 #include <errno.h>
 #include <inttypes.h>
 #include <signal.h>
@@ -39,7 +41,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/select.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
@@ -80,12 +82,16 @@ void OpenThreadClient::Disconnect(void)
         close(mSocket);
         mSocket = -1;
     }
+
+    mReceived.clear();
 }
 
 bool OpenThreadClient::Connect(void)
 {
     struct sockaddr_un sockname;
-    int                ret;
+    int                ret = 0;
+
+    VerifyOrExit(mSocket == -1);
 
     mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
@@ -107,28 +113,30 @@ bool OpenThreadClient::Connect(void)
     }
 
 exit:
+    if (ret != 0)
+    {
+        Disconnect();
+    }
+
     return ret == 0;
 }
 
 void OpenThreadClient::DiscardRead(void)
 {
-    fd_set  readFdSet;
-    timeval timeout = {0, 0};
+    pollfd  pollFd = {mSocket, POLLIN, 0};
     ssize_t count;
-    int     ret;
 
-    for (;;)
-    {
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+    mReceived.clear();
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
-        if (ret <= 0)
+    while (poll(&pollFd, 1, 0) > 0)
+    {
+        count = read(mSocket, mBuffer, sizeof(mBuffer));
+        if (count == 0)
         {
-            break;
+            // The daemon has closed the session.
+            Disconnect();
         }
 
-        count = read(mSocket, mBuffer, sizeof(mBuffer));
         if (count <= 0)
         {
             break;
@@ -136,107 +144,168 @@ void OpenThreadClient::DiscardRead(void)
     }
 }
 
-char *OpenThreadClient::Execute(const char *aFormat, ...)
+bool OpenThreadClient::Receive(Timepoint aDeadline)
 {
-    va_list args;
+    pollfd  pollFd = {mSocket, POLLIN, 0};
+    ssize_t count  = -1;
     int     ret;
-    char   *rval = nullptr;
-    ssize_t count;
-    size_t  rxLength = 0;
-
-    DiscardRead();
-
-    va_start(args, aFormat);
-    ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 1, aFormat, args);
-    va_end(args);
 
-    if (ret < 0)
+    do
     {
-        otbrLogErr("Failed to generate command: %s", strerror(errno));
-    }
+        int timeout = static_cast<int>(
+            std::max<int64_t>(0, std::chrono::duration_cast<Milliseconds>(aDeadline - Clock::now()).count()));
 
-    mBuffer[0] = '\n';
-    ret++;
+        ret = poll(&pollFd, 1, timeout);
+    } while (ret == -1 && errno == EINTR);
 
-    if (ret == sizeof(mBuffer))
-    {
-        otbrLogErr("Command exceeds maximum limit: %d", kBufferSize);
-    }
+    VerifyOrExit(ret > 0);
 
-    mBuffer[ret] = '\n';
-    ret++;
+    count = read(mSocket, mBuffer, sizeof(mBuffer));
+    VerifyOrExit(count > 0);
+    mReceived.append(mBuffer, static_cast<size_t>(count));
 
-    count = write(mSocket, mBuffer, ret);
+exit:
+    return count > 0;
+}
 
-    if (count < ret)
-    {
-        mBuffer[ret] = '\0';
-        otbrLogErr("Failed to send command: %s", mBuffer);
-    }
+bool OpenThreadClient::ReadOutput(std::string &aOutput)
+{
+    static const char kCliPrompt[] = "> "; // The characters of the prompts, which are skipped at the line starts.
+    static const char kDone[]      = "Done";
+    static const char kError[]     = "Error ";
 
-    for (int i = 0; i < mTimeout; ++i)
-    {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char   *done;
+    Timepoint deadline  = Clock::now() + Milliseconds(mTimeout);
+    size_t    lineStart = 0;
+    bool      rval      = false;
 
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+    // The output of a command ends with a line of either "Done" or "Error <code>: <message>". The lines already
+    // scanned are not searched again when more data is received.
+    for (;;)
+    {
+        size_t lineEnd = mReceived.find("\r\n", lineStart);
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
-        VerifyOrExit(ret != -1 || errno == EINTR);
-        if (ret <= 0)
+        if (lineEnd == std::string::npos)
         {
+            VerifyOrExit(Receive(deadline), Disconnect());
             continue;
         }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
-
-        mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n> ");
-
-        if (done != nullptr)
         {
-            // remove trailing \r\n
-            if (done - mBuffer > 2)
+            size_t start = std::min(mReceived.find_first_not_of(kCliPrompt, lineStart), lineEnd);
+
+            if (mReceived.compare(start, lineEnd - start, kDone) == 0 ||
+                mReceived.compare(start, sizeof(kError) - 1, kError) == 0)
             {
-                done[-2] = '\0';
+                rval = mReceived.compare(start, lineEnd - start, kDone) == 0;
+                ExitNow(aOutput.assign(mReceived, 0, lineStart == 0 ? 0 : lineStart - 2));
             }
-
-            rval = mBuffer;
-            break;
         }
+
+        lineStart = lineEnd + 2;
+    }
+
+exit:
+    if (mSocket != -1)
+    {
+        aOutput.erase(0, std::min(aOutput.find_first_not_of(kCliPrompt), aOutput.size()));
+        mReceived.erase(0, mReceived.find("\r\n", lineStart) + 2);
     }
 
+    return rval;
+}
+
+char *OpenThreadClient::Execute(const char *aFormat, ...)
+{
+    va_list                  args;
+    int                      ret;
+    char                    *rval = nullptr;
+    std::vector<std::string> outputs;
+
+    va_start(args, aFormat);
+    ret = vsnprintf(mBuffer, sizeof(mBuffer), aFormat, args);
+    va_end(args);
+
+    VerifyOrExit(ret >= 0, otbrLogErr("Failed to generate command: %s", strerror(errno)));
+    VerifyOrExit(static_cast<size_t>(ret) < sizeof(mBuffer),
+                 otbrLogErr("Command exceeds maximum limit: %d", kBufferSize));
+
+    VerifyOrExit(Execute(std::vector<std::string>{mBuffer}, outputs));
+    mOutput = outputs.front();
+    rval    = &mOutput[0];
+
 exit:
     return rval;
 }
 
-char *OpenThreadClient::Read(const char *aResponse, int aTimeout)
+bool OpenThreadClient::Execute(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs)
 {
-    ssize_t count    = 0;
-    size_t  rxLength = 0;
-    char   *found;
-    char   *rval = nullptr;
+    std::string input;
+    std::string output;
+    size_t      numSucceeded = 0;
+
+    aOutputs.clear();
+    VerifyOrExit(mSocket != -1);
+
+    // The session is reopened if the daemon has closed it, e.g. when the daemon restarted.
+    DiscardRead();
+    VerifyOrExit(mSocket != -1 || Connect());
 
-    for (int i = 0; i < aTimeout; ++i)
+    // The leading new line terminates any partial input.
+    input.push_back('\n');
+    for (const std::string &command : aCommands)
     {
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
+        input.append(command);
+        input.push_back('\n');
+    }
 
-        mBuffer[rxLength] = '\0';
-        found             = strstr(mBuffer, aResponse);
+    if (send(mSocket, input.data(), input.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(input.size()))
+    {
+        otbrLogErr("Failed to send command: %s", aCommands.empty() ? "" : aCommands.front().c_str());
+        Disconnect();
+        ExitNow();
+    }
+
+    // The outputs of the commands after a failed one are still read, so that the session stays in sync.
+    numSucceeded = aCommands.size();
+    for (size_t i = 0; i < aCommands.size(); ++i)
+    {
+        bool succeeded = ReadOutput(output);
 
-        if (found != nullptr)
+        if (!succeeded && numSucceeded > i)
         {
-            rval = mBuffer;
-            break;
+            numSucceeded = i;
+        }
+        else if (i < numSucceeded)
+        {
+            aOutputs.push_back(output);
         }
+
+        // A command which timed out has closed the session.
+        VerifyOrExit(mSocket != -1);
     }
 
+exit:
+    return mSocket != -1 && numSucceeded == aCommands.size();
+}
+
+char *OpenThreadClient::Read(const char *aResponse, int aTimeout)
+{
+    Timepoint deadline      = Clock::now() + Milliseconds(aTimeout);
+    size_t    patternLength = strlen(aResponse);
+    size_t    searched      = 0;
+    char     *rval          = nullptr;
+
+    // The data left by the last command is searched first.
+    while (mReceived.find(aResponse, searched) == std::string::npos)
+    {
+        searched = mReceived.size() >= patternLength ? mReceived.size() - patternLength + 1 : 0;
+        VerifyOrExit(Receive(deadline));
+    }
+
+    mOutput.swap(mReceived);
+    mReceived.clear();
+    rval = &mOutput[0];
+
 exit:
     return rval;
 }
@@ -36,8 +36,13 @@
 
 #include "openthread-br/config.h"
 
+#include <string>
+#include <vector>
+
 #include <stdint.h>
 
+#include "common/time.hpp"
+
 namespace otbr {
 namespace Web {
 
@@ -84,6 +89,8 @@ public:
     /**
      * This method connects to OpenThread daemon.
      *
+     * The session is kept open across commands, and this method does nothing if it is already connected.
+     *
      * @retval TRUE   Successfully connected to the daemon.
      * @retval FALSE  Failed to connected to the daemon.
      *
@@ -101,6 +108,21 @@ public:
      */
     char *Execute(const char *aFormat, ...);
 
+    /**
+     * This method executes OpenThread CLI commands in a pipeline.
+     *
+     * All the commands are sent at once, and then their outputs are read in order, which takes a single round trip
+     * to the daemon instead of one for each command.
+     *
+     * @param[in]  aCommands  The commands.
+     * @param[out] aOutputs   The outputs of the commands which succeeded before the first failure.
+     *
+     * @retval TRUE   All the commands succeeded.
+     * @retval FALSE  A command failed or timed out.
+     *
+     */
+    bool Execute(const std::vector<std::string> &aCommands, std::vector<std::string> &aOutputs);
+
     /**
      * This method reads from OpenThread CLI.
      *
@@ -132,6 +154,8 @@ public:
 private:
     void Disconnect(void);
     void DiscardRead(void);
+    bool Receive(Timepoint aDeadline);
+    bool ReadOutput(std::string &aOutput);
 
     enum
     {
@@ -141,6 +165,8 @@ private:
 
     const char *mNetifName;
     char        mBuffer[kBufferSize];
+    std::string mReceived; ///< The received data which is not consumed yet.
+    std::string mOutput;
     int         mTimeout; /// Timeout in milliseconds
     int         mSocket;
 };
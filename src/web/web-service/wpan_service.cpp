@@ -52,14 +52,17 @@ namespace Web {
 #define CREDENTIAL_TYPE_NETWORK_KEY "networkKeyType"
 #define CREDENTIAL_TYPE_PSKD "pskdType"
 
+// The cached status is refreshed after this timeout even if no request changes the network.
+static const Seconds kStatusCacheTimeout(2);
+
 std::string WpanService::HandleGetQRCodeRequest()
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    char                       *rval;
+    Json::Value                  root, networkInfo;
+    Json::FastWriter             jsonWriter;
+    std::string                  response;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+    char                        *rval;
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
@@ -87,20 +90,21 @@ exit:
 
 std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    Json::Value                 root;
-    Json::Reader                reader;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         index;
-    std::string                 credentialType;
-    std::string                 networkKey;
-    std::string                 pskd;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    char                       *rval;
-
+    Json::Value                  root;
+    Json::Reader                 reader;
+    Json::FastWriter             jsonWriter;
+    std::string                  response;
+    int                          index;
+    std::string                  credentialType;
+    std::string                  networkKey;
+    std::string                  pskd;
+    std::string                  prefix;
+    bool                         defaultRoute;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+    char                        *rval;
+
+    InvalidateStatus();
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -183,24 +187,25 @@ exit:
 
 std::string WpanService::HandleFormNetworkRequest(const std::string &aFormRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    otbr::Psk::Pskc             psk;
-    char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
-    std::string                 networkKey;
-    std::string                 prefix;
-    uint16_t                    channel;
-    std::string                 networkName;
-    std::string                 passphrase;
-    uint16_t                    panId;
-    uint64_t                    extPanId;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    otbr::Psk::Pskc              psk;
+    char                         pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
+    uint8_t                      extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
+    std::string                  networkKey;
+    std::string                  prefix;
+    uint16_t                     channel;
+    std::string                  networkName;
+    std::string                  passphrase;
+    uint16_t                     panId;
+    uint64_t                     extPanId;
+    bool                         defaultRoute;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+
+    InvalidateStatus();
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
@@ -248,15 +253,16 @@ exit:
 
 std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    std::string                  prefix;
+    bool                         defaultRoute;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+
+    InvalidateStatus();
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -288,14 +294,15 @@ exit:
 
 std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-
+    Json::Value                  root;
+    Json::FastWriter             jsonWriter;
+    Json::Reader                 reader;
+    std::string                  response;
+    std::string                  prefix;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+
+    InvalidateStatus();
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -325,12 +332,53 @@ exit:
 
 std::string WpanService::HandleStatusRequest()
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response, networkName, extPanId, propertyValue;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    char                       *rval;
+    Timepoint now = Clock::now();
+
+    // The status is served from the cache until it expires or a request changes the network.
+    if (mStatusResponse.empty() || now >= mStatusExpireTime)
+    {
+        mStatusResponse   = GetStatus();
+        mStatusExpireTime = now + kStatusCacheTimeout;
+    }
+
+    return mStatusResponse;
+}
+
+std::string WpanService::GetStatus(void)
+{
+    static const struct
+    {
+        const char *mCommand;
+        const char *mName;
+    } kStatusProperties[] = {
+        {"version", "OpenThread:Version"},
+        {"version api", "OpenThread:Version API"},
+        {"rcp version", "RCP:Version"},
+        {"eui64", "RCP:EUI64"},
+        {"channel", "RCP:Channel"},
+        {"txpower", "RCP:TxPower"},
+        {"networkname", "Network:Name"},
+        {"extpanid", "Network:XPANID"},
+        {"panid", "Network:PANID"},
+        {"partitionid", "Network:PartitionID"},
+    };
+    static const size_t kNumStatusProperties = sizeof(kStatusProperties) / sizeof(kStatusProperties[0]);
+
+    Json::Value                  root, networkInfo;
+    Json::FastWriter             jsonWriter;
+    std::string                  response, networkName, extPanId, propertyValue;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+    char                        *rval;
+    std::vector<std::string>     commands;
+    std::vector<std::string>     outputs;
+
+    for (const auto &property : kStatusProperties)
+    {
+        commands.push_back(property.mCommand);
+    }
+    commands.push_back("dataset active");
+    commands.push_back("ipaddr");
 
     networkInfo["WPAN service"] = "uninitialized";
     VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
@@ -353,35 +401,13 @@ std::string WpanService::HandleStatusRequest()
         networkInfo["WPAN service"] = "associated";
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("version api")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["OpenThread:Version API"] = rval;
-
-    VerifyOrExit((rval = client.Execute("rcp version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:EUI64"] = rval;
-
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:Channel"] = rval;
+    // The rest of the status is read in a single round trip to the daemon.
+    VerifyOrExit(client.Execute(commands, outputs), ret = kWpanStatus_GetPropertyFailed);
 
-    VerifyOrExit((rval = client.Execute("txpower")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["RCP:TxPower"] = rval;
-
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:Name"] = rval;
-
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:XPANID"] = rval;
-
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PANID"] = rval;
-
-    VerifyOrExit((rval = client.Execute("partitionid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PartitionID"] = rval;
+    for (size_t i = 0; i < kNumStatusProperties; i++)
+    {
+        networkInfo[kStatusProperties[i].mName] = outputs[i];
+    }
 
     {
         static const char kMeshLocalPrefixLocator[]       = "Mesh Local Prefix: ";
@@ -390,8 +416,7 @@ std::string WpanService::HandleStatusRequest()
         static const char linkLocalAddressToken[]         = "fe80";
         std::string       meshLocalPrefix                 = "";
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-        rval = strstr(rval, kMeshLocalPrefixLocator);
+        rval = strstr(&outputs[kNumStatusProperties][0], kMeshLocalPrefixLocator);
         if (rval != nullptr)
         {
             rval += sizeof(kMeshLocalPrefixLocator) - 1;
@@ -402,7 +427,7 @@ std::string WpanService::HandleStatusRequest()
             meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
         }
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        rval = &outputs[kNumStatusProperties + 1][0];
 
         for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
@@ -468,11 +493,11 @@ exit:
 
 std::string WpanService::HandleAvailableNetworkRequest()
 {
-    Json::Value                 root, networks, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    Json::Value                  root, networks, networkInfo;
+    Json::FastWriter             jsonWriter;
+    std::string                  response;
+    int                          ret = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
 
     VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
     VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
@@ -503,9 +528,9 @@ exit:
 
 int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
 {
-    int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
-    const char                 *rval;
+    int                          status = kWpanStatus_Ok;
+    otbr::Web::OpenThreadClient &client(mClient);
+    const char                  *rval;
 
     VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
     rval = client.Execute("state");
@@ -548,7 +573,7 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     pskd = root["pskd"].asString();
 
     {
-        otbr::Web::OpenThreadClient client(mIfName);
+        otbr::Web::OpenThreadClient &client(mClient);
 
         VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
 
@@ -73,6 +73,17 @@ namespace Web {
 class WpanService
 {
 public:
+    /**
+     * The constructor initializes the wpan service.
+     *
+     */
+    WpanService(void)
+        : mNetworksCount(0)
+        , mClient(mIfName)
+    {
+        mIfName[0] = '\0';
+    }
+
     /**
      * This method handles http request to get information to generate QR code.
      *
@@ -194,12 +205,19 @@ private:
                                          uint16_t                     aChannel,
                                          uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
+    std::string        GetStatus(void);
+    void               InvalidateStatus(void) { mStatusResponse.clear(); }
 
     WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
     int             mNetworksCount;
     char            mIfName[IFNAMSIZ];
     std::string     mNetworkName;
     std::string     mExtPanId;
+    std::string     mStatusResponse;
+    Timepoint       mStatusExpireTime;
+
+    // The session to the OpenThread daemon, which is kept open across requests.
+    mutable OpenThreadClient mClient;
 
     enum
     {
@@ -0,0 +1,236 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the benchmarks of the common modules.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/dns_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/task_runner.hpp"
+#include "common/types.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::Bench::KeepAlive;
+
+namespace {
+
+constexpr size_t kTaskBatchSize = 1000;
+
+void InitMainloopContext(otbr::MainloopContext &aMainloop)
+{
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+    aMainloop.mMaxFd           = -1;
+    aMainloop.mTimeout.tv_sec  = 0;
+    aMainloop.mTimeout.tv_usec = 0;
+}
+
+// Runs a mainloop iteration which never blocks.
+void RunMainloopIteration(void)
+{
+    otbr::MainloopContext mainloop;
+    int                   rval;
+
+    InitMainloopContext(mainloop);
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+
+    // Never blocks regardless of the timeout requested by the processors.
+    mainloop.mTimeout.tv_sec  = 0;
+    mainloop.mTimeout.tv_usec = 0;
+
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    VerifyOrDie(rval >= 0, strerror(errno));
+
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+}
+
+/**
+ * This class implements a mainloop processor which watches an idle pipe, like most of the processors of the agent
+ * which watch a socket.
+ *
+ */
+class IdleProcessor : public otbr::MainloopProcessor
+{
+public:
+    IdleProcessor(void)
+    {
+        VerifyOrDie(pipe(mPipe) == 0, strerror(errno));
+    }
+
+    ~IdleProcessor(void) override
+    {
+        close(mPipe[0]);
+        close(mPipe[1]);
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        FD_SET(mPipe[0], &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mPipe[0]);
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        VerifyOrDie(!FD_ISSET(mPipe[0], &aMainloop.mReadFdSet), "The idle pipe is readable");
+    }
+
+private:
+    int mPipe[2];
+};
+
+} // namespace
+
+OTBR_BENCHMARK(BenchmarkTaskRunner)
+{
+    otbr::TaskRunner taskRunner;
+    uint64_t         counter = 0;
+
+    aRunner.Run(
+        "TaskRunner/PostAndRun",
+        [&]() {
+            for (size_t i = 0; i < kTaskBatchSize; ++i)
+            {
+                taskRunner.Post([&counter]() { ++counter; });
+            }
+
+            RunMainloopIteration();
+        },
+        kTaskBatchSize);
+
+    aRunner.Run(
+        "TaskRunner/PostAndCancel",
+        [&]() {
+            for (size_t i = 0; i < kTaskBatchSize; ++i)
+            {
+                taskRunner.Cancel(taskRunner.Post(otbr::Milliseconds::zero(), [&counter]() { ++counter; }));
+            }
+
+            // The canceled tasks are dropped from the queue when they are due.
+            RunMainloopIteration();
+        },
+        kTaskBatchSize);
+
+    KeepAlive(counter);
+}
+
+OTBR_BENCHMARK(BenchmarkMainloop)
+{
+    static const size_t kProcessorCounts[] = {1, 8, 32};
+
+    for (size_t count : kProcessorCounts)
+    {
+        std::vector<std::unique_ptr<IdleProcessor>> processors;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            processors.emplace_back(new IdleProcessor());
+        }
+
+        aRunner.Run("Mainloop/Iteration/" + std::to_string(count), RunMainloopIteration);
+    }
+}
+
+OTBR_BENCHMARK(BenchmarkDnsName)
+{
+    static const char *const kServiceInstanceName = "OpenThread\\.BR._meshcop._udp.default.service.arpa.";
+    static const char *const kHostName            = "otbr-host.default.service.arpa.";
+
+    const std::string serviceInstanceName = kServiceInstanceName;
+
+    aRunner.Run("DnsName/SplitFullDnsName", [&]() { KeepAlive(SplitFullDnsName(serviceInstanceName)); });
+
+    aRunner.Run("DnsName/SplitFullDnsNameView",
+                [&]() { KeepAlive(SplitFullDnsNameView(kServiceInstanceName)); });
+
+    aRunner.Run("DnsName/DnsLabelsEqual", [&]() {
+        DnsNameView view = SplitFullDnsNameView(kServiceInstanceName);
+
+        KeepAlive(DnsLabelsEqual(view.mServiceName, "_MESHCOP._udp"));
+    });
+
+    aRunner.Run("DnsName/AppendName", [&]() {
+        DnsName name;
+
+        SuccessOrDie(name.AppendName(kHostName), "Failed to append the name");
+        KeepAlive(name);
+    });
+}
+
+OTBR_BENCHMARK(BenchmarkIp6Address)
+{
+    static const char *const kAddress = "fd11:22:0:0:1a2b:3c4d:5e6f:7788";
+
+    otbr::Ip6Address address;
+
+    SuccessOrDie(otbr::Ip6Address::FromString(kAddress, address), "Failed to parse the address");
+
+    aRunner.Run("Ip6Address/ToString", [&]() {
+        char buffer[otbr::Ip6Address::kStringSize];
+
+        KeepAlive(address.ToString(buffer));
+    });
+
+    aRunner.Run("Ip6Address/FromString", [&]() {
+        otbr::Ip6Address parsed;
+
+        SuccessOrDie(otbr::Ip6Address::FromString(kAddress, parsed), "Failed to parse the address");
+        KeepAlive(parsed);
+    });
+
+    // The libc conversions as the baselines.
+    aRunner.Run("Ip6Address/inet_ntop", [&]() {
+        char buffer[INET6_ADDRSTRLEN];
+
+        VerifyOrDie(inet_ntop(AF_INET6, address.m8, buffer, sizeof(buffer)) != nullptr, "Failed to format the address");
+        KeepAlive(buffer);
+    });
+
+    aRunner.Run("Ip6Address/inet_pton", [&]() {
+        otbr::Ip6Address parsed;
+
+        VerifyOrDie(inet_pton(AF_INET6, kAddress, parsed.m8) == 1, "Failed to parse the address");
+        KeepAlive(parsed);
+    });
+}
@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the benchmarks of the d-bus message helpers.
+ */
+
+#include <functional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/dbus_dispatch_table.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::Bench::KeepAlive;
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusDispatchTable;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::TupleToDBusMessage;
+
+namespace {
+
+constexpr size_t kNumChildren = 32;
+
+// The arguments of the Attach method: network key, PAN ID, network name, extended PAN ID, PSKc and channel mask.
+typedef std::tuple<std::vector<uint8_t>, uint16_t, std::string, uint64_t, std::vector<uint8_t>, uint32_t> AttachArgs;
+
+std::vector<ChildInfo> MakeChildTable(void)
+{
+    std::vector<ChildInfo> childTable(kNumChildren);
+
+    for (size_t i = 0; i < childTable.size(); ++i)
+    {
+        ChildInfo &child = childTable[i];
+
+        child.mExtAddress         = 0x1122334455667700ull + i;
+        child.mTimeout            = 240;
+        child.mAge                = 10;
+        child.mRloc16             = static_cast<uint16_t>(0x1401 + i);
+        child.mChildId            = static_cast<uint16_t>(i + 1);
+        child.mNetworkDataVersion = 3;
+        child.mLinkQualityIn      = 3;
+        child.mAverageRssi        = -40;
+        child.mLastRssi           = -42;
+        child.mFrameErrorRate     = 0;
+        child.mMessageErrorRate   = 0;
+        child.mRxOnWhenIdle       = (i % 2 == 0);
+        child.mFullThreadDevice   = false;
+        child.mFullNetworkData    = false;
+        child.mIsStateRestoring   = false;
+    }
+
+    return childTable;
+}
+
+template <typename Tuple> void RunEncodeDecode(otbr::Bench::Runner &aRunner, const std::string &aName, Tuple aValues)
+{
+    DBusMessage *message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+    VerifyOrDie(message != nullptr, "Failed to create the message");
+    SuccessOrDie(TupleToDBusMessage(*message, aValues), "Failed to encode the message");
+
+    aRunner.Run("DBus/Encode/" + aName, [&]() {
+        DBusMessage *encoded = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+        VerifyOrDie(encoded != nullptr, "Failed to create the message");
+        SuccessOrDie(TupleToDBusMessage(*encoded, aValues), "Failed to encode the message");
+        dbus_message_unref(encoded);
+    });
+
+    aRunner.Run("DBus/Decode/" + aName, [&]() {
+        Tuple values;
+
+        SuccessOrDie(DBusMessageToTuple(*message, values), "Failed to decode the message");
+        KeepAlive(values);
+    });
+
+    dbus_message_unref(message);
+}
+
+} // namespace
+
+OTBR_BENCHMARK(BenchmarkDBusMessage)
+{
+    RunEncodeDecode(aRunner, "Attach",
+                    AttachArgs{std::vector<uint8_t>(16, 0x00), 0xface, "OpenThread", 0xdead00beef00cafeull,
+                               std::vector<uint8_t>(16, 0x11), 0x07fff800});
+    RunEncodeDecode(aRunner, "ChildTable/" + std::to_string(kNumChildren),
+                    std::tuple<std::vector<ChildInfo>>(MakeChildTable()));
+}
+
+OTBR_BENCHMARK(BenchmarkDBusDispatchTable)
+{
+    using Handler = std::function<int(void)>;
+
+    static const char *const kInterfaceName = "io.openthread.BorderRouter";
+    static const char *const kMemberNames[] = {"Scan",      "Attach",     "Detach",       "Reset",       "JoinerStart",
+                                               "JoinerStop", "LeaderData", "NetworkData", "ChildTable", "Rloc16"};
+    constexpr size_t         kNumMembers    = sizeof(kMemberNames) / sizeof(kMemberNames[0]);
+
+    DBusDispatchTable<Handler>               table;
+    std::unordered_map<std::string, Handler> map;
+    int                                      sum = 0;
+
+    for (const char *name : kMemberNames)
+    {
+        table.Add(kInterfaceName, name, []() { return 1; });
+        map.emplace(std::string(kInterfaceName) + "." + name, []() { return 1; });
+    }
+
+    aRunner.Run(
+        "DBus/DispatchTable/Find",
+        [&]() {
+            for (const char *name : kMemberNames)
+            {
+                sum += (*table.Find(kInterfaceName, name))();
+            }
+        },
+        kNumMembers);
+
+    // The lookup by the concatenated names, which the dispatch table replaces.
+    aRunner.Run(
+        "DBus/DispatchTable/UnorderedMapFind",
+        [&]() {
+            for (const char *name : kMemberNames)
+            {
+                std::string fullName = std::string(kInterfaceName) + "." + name;
+
+                sum += map.find(fullName)->second();
+            }
+        },
+        kNumMembers);
+
+    KeepAlive(sum);
+}
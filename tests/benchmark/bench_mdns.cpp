@@ -0,0 +1,129 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the benchmarks of the mDNS publisher.
+ */
+
+#include <sstream>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "mdns/mdns.hpp"
+#include "mdns/mdns_mock.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::Bench::KeepAlive;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherMock;
+using otbr::Mdns::PublisherReplayer;
+
+OTBR_BENCHMARK(BenchmarkTxtData)
+{
+    static const uint8_t kExtPanId[]    = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    static const uint8_t kStateBitmap[] = {0x00, 0x00, 0x01, 0xb1};
+
+    // A TXT entry list like the one of the MeshCoP service.
+    Publisher::TxtList txtList{
+        {"rv", "1"},
+        {"tv", "1.3.0"},
+        {"nn", "OpenThread"},
+        {"xp", kExtPanId, sizeof(kExtPanId)},
+        {"vn", "OpenThread"},
+        {"mn", "BorderRouter"},
+        {"sb", kStateBitmap, sizeof(kStateBitmap)},
+        {"dn", "DefaultDomain"},
+    };
+    std::vector<uint8_t> txtData;
+
+    SuccessOrDie(Publisher::EncodeTxtData(txtList, txtData), "Failed to encode the TXT data");
+
+    aRunner.Run("Mdns/EncodeTxtData", [&]() {
+        std::vector<uint8_t> data;
+
+        SuccessOrDie(Publisher::EncodeTxtData(txtList, data), "Failed to encode the TXT data");
+        KeepAlive(data);
+    });
+
+    aRunner.Run("Mdns/DecodeTxtData", [&]() {
+        Publisher::TxtList list;
+
+        SuccessOrDie(Publisher::DecodeTxtData(list, txtData.data(), txtData.size()), "Failed to decode the TXT data");
+        KeepAlive(list);
+    });
+}
+
+OTBR_BENCHMARK(BenchmarkReplay)
+{
+    // The number of hosts, each of which has a service, like the SRP clients of a large Thread network.
+    static const int kNumHosts[] = {1000, 10000};
+
+    for (int numHosts : kNumHosts)
+    {
+        PublisherMock::Config config;
+        PublisherMock         publisher([](Publisher::State) {}, config);
+        PublisherReplayer     replayer(publisher);
+        std::ostringstream    trace;
+        uint64_t              numOperations = 4 * static_cast<uint64_t>(numHosts) + 1;
+
+        if (!aRunner.IsSelected("Mdns/Replay/" + std::to_string(numHosts)))
+        {
+            continue;
+        }
+
+        trace << "subscribe-service _srpl-tls._tcp\n";
+
+        for (int i = 0; i < numHosts; i++)
+        {
+            trace << "publish-host host" << i << " fd00::" << std::hex << i + 1 << std::dec << "\n";
+            trace << "publish-service host" << i << " service" << i << " _srpl-tls._tcp " << 10000 + i % 50000
+                  << " dn=DefaultDomain xp=dead00beef00cafe\n";
+        }
+
+        for (int i = 0; i < numHosts; i++)
+        {
+            trace << "unpublish-service service" << i << " _srpl-tls._tcp\n";
+            trace << "unpublish-host host" << i << "\n";
+        }
+
+        {
+            std::istringstream input(trace.str());
+
+            SuccessOrDie(replayer.Load(input), "Failed to load the trace");
+        }
+
+        SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+
+        aRunner.Run(
+            "Mdns/Replay/" + std::to_string(numHosts), [&]() { replayer.Replay(); }, numOperations);
+
+        VerifyOrDie(replayer.GetNumPending() == 0 && replayer.GetCounters().mFailed == 0, "Replay failed");
+    }
+}
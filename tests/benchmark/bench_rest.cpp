@@ -0,0 +1,276 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the benchmarks of the REST server.
+ */
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "rest/cbor.hpp"
+#include "rest/json.hpp"
+#include "rest/parser.hpp"
+#include "rest/request.hpp"
+#include "rest/response.hpp"
+#include "rest/router.hpp"
+
+#include "benchmark.hpp"
+
+using otbr::Bench::KeepAlive;
+using otbr::rest::Parser;
+using otbr::rest::Request;
+using otbr::rest::Response;
+using otbr::rest::Router;
+
+namespace {
+
+// The data returned by the stubbed Thread stack.
+struct StubbedNode
+{
+    StubbedNode(void)
+    {
+        otNetworkDiagTlv tlv;
+
+        memset(&mLeaderData, 0, sizeof(mLeaderData));
+        mLeaderData.mPartitionId       = 0x12345678;
+        mLeaderData.mWeighting         = 64;
+        mLeaderData.mDataVersion       = 3;
+        mLeaderData.mStableDataVersion = 2;
+        mLeaderData.mLeaderRouterId    = 5;
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+        memset(tlv.mData.mExtAddress.m8, 0xab, sizeof(tlv.mData.mExtAddress.m8));
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+        tlv.mData.mAddr16 = 0x1400;
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_MODE;
+        tlv.mData.mMode.mRxOnWhenIdle = true;
+        tlv.mData.mMode.mDeviceType   = true;
+        tlv.mData.mMode.mNetworkData  = true;
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType             = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+        tlv.mData.mLeaderData = mLeaderData;
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST;
+        tlv.mData.mIp6AddrList.mCount = 3;
+        for (uint8_t i = 0; i < tlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            tlv.mData.mIp6AddrList.mList[i].mFields.m8[0]  = 0xfd;
+            tlv.mData.mIp6AddrList.mList[i].mFields.m8[15] = i + 1;
+        }
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+        tlv.mData.mRoute.mRouteCount = 4;
+        for (uint8_t i = 0; i < tlv.mData.mRoute.mRouteCount; ++i)
+        {
+            tlv.mData.mRoute.mRouteData[i].mRouterId       = i * 5;
+            tlv.mData.mRoute.mRouteData[i].mLinkQualityIn  = 3;
+            tlv.mData.mRoute.mRouteData[i].mLinkQualityOut = 3;
+            tlv.mData.mRoute.mRouteData[i].mRouteCost      = 1;
+        }
+        mDiag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+        tlv.mData.mChildTable.mCount = 4;
+        for (uint8_t i = 0; i < tlv.mData.mChildTable.mCount; ++i)
+        {
+            tlv.mData.mChildTable.mTable[i].mTimeout = 10;
+            tlv.mData.mChildTable.mTable[i].mChildId = i + 1;
+        }
+        mDiag.push_back(tlv);
+    }
+
+    otLeaderData                  mLeaderData;
+    std::vector<otNetworkDiagTlv> mDiag;
+};
+
+typedef std::function<void(const Request &aRequest, Response &aResponse)> Handler;
+
+/**
+ * This class implements a REST server which serves the requests of a connection with the request parser, router
+ * and response of the REST server of the agent, and the data of a stubbed Thread stack.
+ *
+ */
+class StubbedServer
+{
+public:
+    explicit StubbedServer(int aFd)
+        : mFd(aFd)
+        , mParser(&mRequest)
+    {
+        mRouter.Add("/node/leader-data", [this](const Request &, Response &aResponse) {
+            SetBody(aResponse, otbr::rest::Json::LeaderData2JsonString(mNode.mLeaderData));
+        });
+        mRouter.Add("/node/rloc16", [](const Request &, Response &aResponse) {
+            SetBody(aResponse, otbr::rest::Json::Number2JsonString(0x1400));
+        });
+        mRouter.Add("/diagnostics/{rloc16}", [this](const Request &, Response &aResponse) {
+            SetBody(aResponse, otbr::rest::Json::NodeDiag2JsonString(mNode.mDiag));
+        });
+    }
+
+    // Serves a request, and returns the length of the response.
+    size_t Serve(void)
+    {
+        char           buffer[2048];
+        ssize_t        received;
+        Response       response;
+        const Handler *handler;
+        std::string    data;
+        ssize_t        sent;
+
+        mRequest.Reset();
+        mParser.Init();
+
+        do
+        {
+            received = read(mFd, buffer, sizeof(buffer));
+            VerifyOrDie(received > 0, "Failed to read the request");
+            mParser.Process(buffer, static_cast<size_t>(received));
+        } while (!mRequest.IsComplete());
+
+        handler = mRouter.Match(mRequest);
+        VerifyOrDie(handler != nullptr, "No handler of the request");
+        (*handler)(mRequest, response);
+
+        data = response.Serialize();
+        sent = write(mFd, data.data(), data.size());
+        VerifyOrDie(sent == static_cast<ssize_t>(data.size()), "Failed to write the response");
+
+        return data.size();
+    }
+
+private:
+    static void SetBody(Response &aResponse, std::string aBody)
+    {
+        std::string code = "200 OK";
+
+        aResponse.SetBody(aBody);
+        aResponse.SetResponsCode(code);
+    }
+
+    int             mFd;
+    StubbedNode     mNode;
+    Request         mRequest;
+    Parser          mParser;
+    Router<Handler> mRouter;
+};
+
+void WriteAll(int aFd, const std::string &aData)
+{
+    VerifyOrDie(write(aFd, aData.data(), aData.size()) == static_cast<ssize_t>(aData.size()),
+                "Failed to write the request");
+}
+
+void ReadAll(int aFd, size_t aLength)
+{
+    char buffer[4096];
+
+    while (aLength > 0)
+    {
+        ssize_t received = read(aFd, buffer, std::min(aLength, sizeof(buffer)));
+
+        VerifyOrDie(received > 0, "Failed to read the response");
+        aLength -= static_cast<size_t>(received);
+    }
+}
+
+} // namespace
+
+OTBR_BENCHMARK(BenchmarkRestSerializers)
+{
+    StubbedNode node;
+
+    aRunner.Run("Rest/LeaderData/cJSON",
+                [&]() { KeepAlive(otbr::rest::Json::LeaderData2JsonString(node.mLeaderData)); });
+
+    aRunner.Run("Rest/LeaderData/Cbor", [&]() {
+        std::string buffer;
+
+        otbr::rest::Cbor::LeaderData2Cbor(node.mLeaderData, buffer);
+        KeepAlive(buffer);
+    });
+
+    aRunner.Run("Rest/NodeDiag/cJSON", [&]() { KeepAlive(otbr::rest::Json::NodeDiag2JsonString(node.mDiag)); });
+
+    aRunner.Run("Rest/NodeDiag/Cbor", [&]() {
+        std::string buffer;
+
+        otbr::rest::Cbor::NodeDiag2Cbor(node.mDiag, buffer);
+        KeepAlive(buffer);
+    });
+}
+
+OTBR_BENCHMARK(BenchmarkRestRequest)
+{
+    static const char *const kRequests[] = {
+        "GET /node/leader-data HTTP/1.1\r\nHost: localhost\r\nAccept: application/json\r\n\r\n",
+        "GET /node/rloc16 HTTP/1.1\r\nHost: localhost\r\nAccept: application/json\r\n\r\n",
+        "GET /diagnostics/0x1400 HTTP/1.1\r\nHost: localhost\r\nAccept: application/json\r\n\r\n",
+    };
+
+    int fds[2];
+
+    VerifyOrDie(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, strerror(errno));
+
+    {
+        StubbedServer server(fds[1]);
+        size_t        index = 0;
+
+        // Each request is written by the client, served and then read back by the client.
+        aRunner.Run("Rest/Request", [&]() {
+            WriteAll(fds[0], kRequests[index++ % (sizeof(kRequests) / sizeof(kRequests[0]))]);
+            ReadAll(fds[0], server.Serve());
+        });
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the OTBR benchmark harness.
+ */
+
+#ifndef OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
+#define OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+namespace otbr {
+namespace Bench {
+
+/**
+ * This structure represents the result of a benchmark case.
+ *
+ */
+struct Result
+{
+    std::string mName;       ///< The name of the case.
+    uint64_t    mIterations; ///< The number of measured operations.
+    double      mNsPerOp;    ///< The average time of an operation in nanoseconds.
+};
+
+/**
+ * This class runs the benchmark cases and collects their results.
+ *
+ */
+class Runner
+{
+public:
+    /**
+     * The constructor initializes a runner.
+     *
+     * @param[in] aFilter   Only the cases whose names contain this string are run.
+     * @param[in] aMinTime  The minimum time of measuring a case.
+     *
+     */
+    Runner(std::string aFilter, std::chrono::milliseconds aMinTime)
+        : mFilter(std::move(aFilter))
+        , mMinTime(aMinTime)
+    {
+    }
+
+    /**
+     * This method returns whether a case is selected by the filter.
+     *
+     * @param[in] aName  The name of the case.
+     *
+     * @returns Whether the case is selected.
+     *
+     */
+    bool IsSelected(const std::string &aName) const { return aName.find(mFilter) != std::string::npos; }
+
+    /**
+     * This method measures a case and records its result.
+     *
+     * @p aFunc is called repeatedly, with more calls in each round until a round takes at least the minimum time.
+     *
+     * @param[in] aName          The name of the case.
+     * @param[in] aFunc          The function which does @p aOpsPerCall operations in each call.
+     * @param[in] aOpsPerCall    The number of operations done by each call of @p aFunc.
+     *
+     */
+    template <typename Func> void Run(const std::string &aName, Func &&aFunc, uint64_t aOpsPerCall = 1)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        uint64_t                 calls = 1;
+        std::chrono::nanoseconds elapsed;
+        double                   scale;
+
+        if (!IsSelected(aName))
+        {
+            return;
+        }
+
+        while (true)
+        {
+            Clock::time_point start = Clock::now();
+
+            for (uint64_t i = 0; i < calls; ++i)
+            {
+                aFunc();
+            }
+
+            elapsed = Clock::now() - start;
+
+            if (elapsed >= mMinTime || calls >= kMaxCalls)
+            {
+                break;
+            }
+
+            // Aims at 120% of the minimum time, but grows by at most 100 times in a round.
+            scale = 1.2 * std::chrono::nanoseconds(mMinTime).count() / std::max<int64_t>(elapsed.count(), 1);
+            calls = static_cast<uint64_t>(calls * std::min(scale, 100.0));
+            calls = std::min(std::max<uint64_t>(calls, 2), kMaxCalls);
+        }
+
+        mResults.push_back({aName, calls * aOpsPerCall, static_cast<double>(elapsed.count()) / (calls * aOpsPerCall)});
+    }
+
+    /**
+     * This method returns the results of all the cases that have run.
+     *
+     * @returns The results.
+     *
+     */
+    const std::vector<Result> &GetResults(void) const { return mResults; }
+
+private:
+    static constexpr uint64_t kMaxCalls = 1000000000;
+
+    std::string               mFilter;
+    std::chrono::milliseconds mMinTime;
+    std::vector<Result>       mResults;
+};
+
+/**
+ * This type represents a benchmark which runs one or more cases.
+ *
+ */
+typedef void (*Benchmark)(Runner &aRunner);
+
+/**
+ * This class registers a benchmark at static initialization.
+ *
+ */
+class Registrar
+{
+public:
+    /**
+     * The constructor registers a benchmark.
+     *
+     * @param[in] aBenchmark  The benchmark.
+     *
+     */
+    explicit Registrar(Benchmark aBenchmark) { GetBenchmarks().push_back(aBenchmark); }
+
+    /**
+     * This method returns all the registered benchmarks.
+     *
+     * @returns The benchmarks.
+     *
+     */
+    static std::vector<Benchmark> &GetBenchmarks(void)
+    {
+        static std::vector<Benchmark> sBenchmarks;
+
+        return sBenchmarks;
+    }
+};
+
+/**
+ * This function prevents the compiler from optimizing away the computation of a value.
+ *
+ * @param[in] aValue  The value.
+ *
+ */
+template <typename T> inline void KeepAlive(const T &aValue)
+{
+    asm volatile("" : : "r"(&aValue) : "memory");
+}
+
+} // namespace Bench
+} // namespace otbr
+
+/**
+ * This macro defines and registers a benchmark.
+ *
+ * @param[in] aName  The name of the benchmark function.
+ *
+ */
+#define OTBR_BENCHMARK(aName)                                \
+    static void aName(otbr::Bench::Runner &aRunner);        \
+    static otbr::Bench::Registrar sRegistrar##aName(aName); \
+    static void aName(otbr::Bench::Runner &aRunner)
+
+#endif // OTBR_TESTS_BENCHMARK_BENCHMARK_HPP_
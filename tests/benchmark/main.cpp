@@ -0,0 +1,152 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the entry of the OTBR benchmarks, which prints the results in JSON.
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread-br/config.h>
+
+#include "common/code_utils.hpp"
+
+#include "benchmark.hpp"
+
+constexpr uint64_t otbr::Bench::Runner::kMaxCalls;
+
+enum
+{
+    OTBR_OPT_FILTER   = 'f',
+    OTBR_OPT_HELP     = 'h',
+    OTBR_OPT_OUTPUT   = 'o',
+    OTBR_OPT_MIN_TIME = 't',
+};
+
+static const struct option kOptions[] = {
+    {"filter", required_argument, nullptr, OTBR_OPT_FILTER},
+    {"help", no_argument, nullptr, OTBR_OPT_HELP},
+    {"output", required_argument, nullptr, OTBR_OPT_OUTPUT},
+    {"min-time", required_argument, nullptr, OTBR_OPT_MIN_TIME},
+    {0, 0, 0, 0}};
+
+static void PrintHelp(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [-f FILTER] [-o OUTPUT] [-t MIN_TIME_MS]\n"
+            "    -f, --filter    Only runs the cases whose names contain FILTER.\n"
+            "    -o, --output    Writes the JSON results to OUTPUT instead of the standard output.\n"
+            "    -t, --min-time  Measures each case for at least MIN_TIME_MS milliseconds (default: 200).\n",
+            aProgramName);
+}
+
+static void PrintResults(FILE *aFile, const std::vector<otbr::Bench::Result> &aResults)
+{
+    fprintf(aFile, "{\n  \"version\": \"%s\",\n  \"benchmarks\": [", OTBR_PACKAGE_VERSION);
+
+    for (size_t i = 0; i < aResults.size(); ++i)
+    {
+        const otbr::Bench::Result &result = aResults[i];
+
+        // The names of the cases never contain characters which need escaping.
+        fprintf(aFile, "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.2f}", i == 0 ? "" : ",",
+                result.mName.c_str(), static_cast<unsigned long long>(result.mIterations), result.mNsPerOp);
+    }
+
+    fprintf(aFile, "\n  ]\n}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    int         ret     = EXIT_FAILURE;
+    const char *filter  = "";
+    const char *output  = nullptr;
+    long        minTime = 200;
+    FILE       *file    = stdout;
+    int         opt;
+    char       *end;
+
+    while ((opt = getopt_long(argc, argv, "f:ho:t:", kOptions, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case OTBR_OPT_FILTER:
+            filter = optarg;
+            break;
+
+        case OTBR_OPT_OUTPUT:
+            output = optarg;
+            break;
+
+        case OTBR_OPT_MIN_TIME:
+            minTime = strtol(optarg, &end, 0);
+            VerifyOrExit(*optarg != '\0' && *end == '\0' && minTime > 0, PrintHelp(argv[0]));
+            break;
+
+        case OTBR_OPT_HELP:
+            PrintHelp(argv[0]);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+
+        default:
+            PrintHelp(argv[0]);
+            ExitNow();
+            break;
+        }
+    }
+
+    {
+        otbr::Bench::Runner runner(filter, std::chrono::milliseconds(minTime));
+
+        for (otbr::Bench::Benchmark benchmark : otbr::Bench::Registrar::GetBenchmarks())
+        {
+            benchmark(runner);
+        }
+
+        if (output != nullptr)
+        {
+            file = fopen(output, "w");
+            VerifyOrExit(file != nullptr, perror(output));
+        }
+
+        PrintResults(file, runner.GetResults());
+    }
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    if (file != nullptr && file != stdout)
+    {
+        fclose(file);
+    }
+
+    return ret;
+}
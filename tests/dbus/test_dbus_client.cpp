@@ -48,8 +48,11 @@ using otbr::DBus::ExternalRoute;
 using otbr::DBus::Ip6Prefix;
 using otbr::DBus::LinkModeConfig;
 using otbr::DBus::OnMeshPrefix;
+using otbr::DBus::PropertyValues;
 using otbr::DBus::SrpServerInfo;
+using otbr::DBus::StartupMilestone;
 using otbr::DBus::ThreadApiDBus;
+using otbr::DBus::TopologyNode;
 using otbr::DBus::TxtEntry;
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -151,6 +154,71 @@ static void CheckFeatureFlagUpdate(ThreadApiDBus *aApi)
 #endif
 }
 
+static void CheckAsyncProperties(ThreadApiDBus *aApi, DBusConnection *aConnection)
+{
+    bool           setDone        = false;
+    bool           regionDone     = false;
+    bool           propertiesDone = false;
+    PropertyValues values;
+    std::string    region;
+    uint32_t       preferredChannelMask = 0;
+
+    TEST_ASSERT(aApi->SetPropertyAsync(OTBR_DBUS_PROPERTY_RADIO_REGION, std::string("US"),
+                                       [&setDone](ClientError aError) {
+                                           TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                           setDone = true;
+                                       }) == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetPropertyAsync<std::string>(OTBR_DBUS_PROPERTY_RADIO_REGION,
+                                                    [&regionDone](ClientError aError, const std::string &aRegion) {
+                                                        TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                                        TEST_ASSERT(aRegion == "US");
+                                                        regionDone = true;
+                                                    }) == ClientError::ERROR_NONE);
+    TEST_ASSERT(aApi->GetPropertiesAsync({OTBR_DBUS_PROPERTY_RADIO_REGION, OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK},
+                                         [&propertiesDone](ClientError aError, const PropertyValues &aValues) {
+                                             std::string asyncRegion;
+                                             uint32_t    mask = 0;
+
+                                             TEST_ASSERT(aError == ClientError::ERROR_NONE);
+                                             TEST_ASSERT(aValues.GetSize() == 2);
+                                             TEST_ASSERT(aValues.Get(0, asyncRegion) == ClientError::ERROR_NONE);
+                                             TEST_ASSERT(asyncRegion == "US");
+                                             TEST_ASSERT(aValues.Get(1, mask) == ClientError::ERROR_NONE);
+                                             TEST_ASSERT(mask == 0x7fff800);
+                                             propertiesDone = true;
+                                         }) == ClientError::ERROR_NONE);
+
+    while (!setDone || !regionDone || !propertiesDone)
+    {
+        dbus_connection_read_write_dispatch(aConnection, 0);
+    }
+
+    TEST_ASSERT(aApi->GetProperties({OTBR_DBUS_PROPERTY_RADIO_REGION, OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK},
+                                    values) == ClientError::ERROR_NONE);
+    TEST_ASSERT(values.Get(0, region) == ClientError::ERROR_NONE);
+    TEST_ASSERT(region == "US");
+    TEST_ASSERT(values.Get(1, preferredChannelMask) == ClientError::ERROR_NONE);
+    TEST_ASSERT(preferredChannelMask == 0x7fff800);
+    TEST_ASSERT(values.Get(2, region) == ClientError::OT_ERROR_INVALID_ARGS);
+}
+
+void CheckGetOffloadedProperties(ThreadApiDBus                            *aApi,
+                                 const std::vector<otbr::DBus::ChildInfo> &aChildTable,
+                                 uint16_t                                  aRloc16)
+{
+    PropertyValues                     values;
+    std::vector<otbr::DBus::ChildInfo> childTable;
+    uint16_t                           rloc16;
+
+    TEST_ASSERT(aApi->GetProperties({OTBR_DBUS_PROPERTY_CHILD_TABLE, OTBR_DBUS_PROPERTY_RLOC16}, values) ==
+                ClientError::ERROR_NONE);
+    TEST_ASSERT(values.GetSize() == 2);
+    TEST_ASSERT(values.Get(0, childTable) == ClientError::ERROR_NONE);
+    TEST_ASSERT(childTable.size() == aChildTable.size());
+    TEST_ASSERT(values.Get(1, rloc16) == ClientError::ERROR_NONE);
+    TEST_ASSERT(rloc16 == aRloc16);
+}
+
 void CheckSrpServerInfo(ThreadApiDBus *aApi)
 {
     SrpServerInfo srpServerInfo;
@@ -178,6 +246,45 @@ void CheckSrpServerInfo(ThreadApiDBus *aApi)
     TEST_ASSERT(srpServerInfo.mResponseCounters.mOther == 0);
 }
 
+void CheckTopology(ThreadApiDBus *aApi, uint16_t aRloc16, uint64_t aExtAddress, size_t aChildCount)
+{
+    std::vector<TopologyNode> topology;
+    bool                      found = false;
+
+    TEST_ASSERT(aApi->GetTopology(topology) == OTBR_ERROR_NONE);
+
+    for (const TopologyNode &node : topology)
+    {
+        if (node.mRloc16 == aRloc16)
+        {
+            TEST_ASSERT(node.mExtAddress == aExtAddress);
+            TEST_ASSERT(node.mChildren.size() == aChildCount);
+            found = true;
+        }
+    }
+
+    TEST_ASSERT(found);
+}
+
+void CheckStartupTimeline(ThreadApiDBus *aApi)
+{
+    std::vector<StartupMilestone> timeline;
+    uint64_t                      elapsed  = 0;
+    bool                          attached = false;
+
+    TEST_ASSERT(aApi->GetStartupTimeline(timeline) == OTBR_ERROR_NONE);
+    TEST_ASSERT(!timeline.empty());
+
+    for (const StartupMilestone &milestone : timeline)
+    {
+        TEST_ASSERT(milestone.mElapsed >= elapsed);
+        elapsed  = milestone.mElapsed;
+        attached = attached || milestone.mName == "thread-attached";
+    }
+
+    TEST_ASSERT(attached);
+}
+
 void CheckDnssdCounters(ThreadApiDBus *aApi)
 {
     OTBR_UNUSED_VARIABLE(aApi);
@@ -269,6 +376,8 @@ int main()
     TEST_ASSERT(api->GetPreferredChannelMask(preferredChannelMask) == ClientError::ERROR_NONE);
     TEST_ASSERT(preferredChannelMask == 0x7fff800);
 
+    CheckAsyncProperties(api.get(), connection.get());
+
     api->EnergyScan(scanDuration, [&stepDone](const std::vector<EnergyScanResult> &aResult) {
         TEST_ASSERT(!aResult.empty());
         printf("Energy Scan:\n");
@@ -346,6 +455,9 @@ int main()
                             TEST_ASSERT(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetActiveDatasetTlvs(activeDataset) == OTBR_ERROR_NONE);
+                            CheckTopology(api.get(), rloc16, extAddress, childTable.size());
+                            CheckStartupTimeline(api.get());
+                            CheckGetOffloadedProperties(api.get(), childTable, rloc16);
                             CheckSrpServerInfo(api.get());
                             CheckMdnsInfo(api.get());
                             CheckDnssdCounters(api.get());
@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2023, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Runs a swarm of simulated Thread nodes against otbr-agent and reports the latencies and the agent's resource usage.
+
+The nodes are OpenThread POSIX simulation CLIs (ot-cli-ftd/ot-cli-mtd) which talk to each other and to the RCP of
+otbr-agent over the loopback interface. Every node joins the network of otbr-agent and registers a service with the
+SRP server of the agent. Then, for the given duration, the swarm sends DNS-SD browse queries from the nodes, and polls
+the REST API and requests network diagnostics from the agent.
+
+The OpenThread simulation supports at most 33 nodes by default, build it with a larger OT_SIMULATION_MAX_NETWORK_SIZE
+for larger networks.
+"""
+
+import argparse
+import json
+import os
+import random
+import select
+import subprocess
+import sys
+import threading
+import time
+import urllib.request
+from concurrent.futures import ThreadPoolExecutor
+
+SERVICE_TYPE = "_otbr-load._udp"
+SERVICE_PORT = 49152
+REST_PATHS = ["/node", "/node/state", "/node/rloc16", "/node/leader-data", "/node/num-of-router"]
+
+
+class CliError(Exception):
+
+    def __init__(self, node_id, command, output):
+        super().__init__("node %d: '%s' failed: %s" % (node_id, command, output))
+
+
+class Node(object):
+    """A simulated node controlled through its CLI."""
+
+    def __init__(self, node_id, cli_path):
+        self.id = node_id
+        self._process = subprocess.Popen([cli_path, str(node_id)],
+                                         stdin=subprocess.PIPE,
+                                         stdout=subprocess.PIPE,
+                                         stderr=subprocess.DEVNULL,
+                                         bufsize=0)
+        self._buffer = b""
+        self._lock = threading.Lock()
+
+    def command(self, command, timeout=10):
+        """Runs a CLI command and returns its output lines, excluding the final "Done"."""
+        with self._lock:
+            deadline = time.monotonic() + timeout
+            output = []
+
+            self._process.stdin.write((command + "\n").encode())
+
+            while True:
+                line = self._read_line(deadline)
+
+                if line is None:
+                    raise CliError(self.id, command, "timeout")
+                if line == "Done":
+                    return output
+                if line.startswith("Error"):
+                    raise CliError(self.id, command, line)
+                if line and line != command:
+                    output.append(line)
+
+    def wait_for(self, command, expected, timeout):
+        """Runs a CLI command repeatedly until one of its output lines contains one of the expected strings."""
+        deadline = time.monotonic() + timeout
+
+        while time.monotonic() < deadline:
+            if any(e in line for line in self.command(command) for e in expected):
+                return True
+            time.sleep(0.05)
+
+        return False
+
+    def close(self):
+        self._process.kill()
+        self._process.wait()
+
+    def _read_line(self, deadline):
+        while b"\n" not in self._buffer:
+            remaining = deadline - time.monotonic()
+
+            if remaining <= 0 or not select.select([self._process.stdout], [], [], remaining)[0]:
+                return None
+
+            data = os.read(self._process.stdout.fileno(), 4096)
+            if not data:
+                return None
+            self._buffer += data
+
+        line, self._buffer = self._buffer.split(b"\n", 1)
+        line = line.decode(errors="replace").strip()
+
+        # The prompt is not followed by a new line.
+        while line.startswith("> "):
+            line = line[2:]
+        return line
+
+
+class Recorder(object):
+    """Records the latencies and failures of each kind of operation."""
+
+    def __init__(self):
+        self._latencies = {}
+        self._errors = {}
+        self._lock = threading.Lock()
+
+    def measure(self, name, func, *args):
+        start = time.monotonic()
+        try:
+            result = func(*args)
+        except Exception as e:
+            with self._lock:
+                self._errors[name] = self._errors.get(name, 0) + 1
+            print("%s failed: %s" % (name, e), file=sys.stderr)
+            return None
+
+        with self._lock:
+            self._latencies.setdefault(name, []).append(time.monotonic() - start)
+        return result
+
+    def report(self):
+        report = {}
+
+        for name in sorted(set(self._latencies) | set(self._errors)):
+            latencies = sorted(self._latencies.get(name, []))
+            entry = {"count": len(latencies), "errors": self._errors.get(name, 0)}
+
+            if latencies:
+                for percentile in (50, 90, 99):
+                    entry["p%d_ms" % percentile] = round(percentile_of(latencies, percentile) * 1000, 3)
+                entry["max_ms"] = round(latencies[-1] * 1000, 3)
+
+            report[name] = entry
+
+        return report
+
+
+class AgentMonitor(threading.Thread):
+    """Samples the CPU and memory usage of otbr-agent."""
+
+    INTERVAL = 1.0
+
+    def __init__(self, pid):
+        super().__init__(daemon=True)
+        self._pid = pid
+        self._clock_ticks = os.sysconf("SC_CLK_TCK")
+        self._stopped = threading.Event()
+        self._cpu_percents = []
+        self._rss_kb = []
+
+    def run(self):
+        last_ticks = self._read_cpu_ticks()
+        last_time = time.monotonic()
+
+        while not self._stopped.wait(self.INTERVAL):
+            ticks = self._read_cpu_ticks()
+            now = time.monotonic()
+
+            self._cpu_percents.append(100.0 * (ticks - last_ticks) / self._clock_ticks / (now - last_time))
+            self._rss_kb.append(self._read_rss_kb())
+            last_ticks, last_time = ticks, now
+
+    def stop(self):
+        self._stopped.set()
+        self.join()
+
+    def report(self):
+        if not self._cpu_percents:
+            return {}
+
+        return {
+            "cpu_avg_percent": round(sum(self._cpu_percents) / len(self._cpu_percents), 2),
+            "cpu_max_percent": round(max(self._cpu_percents), 2),
+            "rss_avg_kb": sum(self._rss_kb) // len(self._rss_kb),
+            "rss_max_kb": max(self._rss_kb),
+        }
+
+    def _read_cpu_ticks(self):
+        with open("/proc/%d/stat" % self._pid) as f:
+            # The command name in the second field may contain spaces.
+            fields = f.read().rsplit(")", 1)[1].split()
+        # utime and stime are the 14th and 15th fields.
+        return int(fields[11]) + int(fields[12])
+
+    def _read_rss_kb(self):
+        with open("/proc/%d/status" % self._pid) as f:
+            for line in f:
+                if line.startswith("VmRSS:"):
+                    return int(line.split()[1])
+        return 0
+
+
+def percentile_of(sorted_values, percentile):
+    """Returns the nearest-rank percentile of sorted values."""
+    rank = max(1, -(-percentile * len(sorted_values) // 100))
+    return sorted_values[rank - 1]
+
+
+def rest_get(url, timeout):
+    with urllib.request.urlopen(url, timeout=timeout) as response:
+        return response.read()
+
+
+def join_node(node, dataset):
+    node.command("dataset set active %s" % dataset)
+    node.command("ifconfig up")
+    node.command("thread start")
+    if not node.wait_for("state", ["child", "router", "leader"], timeout=120):
+        raise CliError(node.id, "state", "not attached")
+
+
+def register_service(node):
+    node.command("srp client host name load-node-%d" % node.id)
+    node.command("srp client host address auto")
+    node.command("srp client service add load-node-%d %s %d" % (node.id, SERVICE_TYPE, SERVICE_PORT))
+    node.command("srp client autostart enable")
+    if not node.wait_for("srp client host state", ["Registered"], timeout=60):
+        raise CliError(node.id, "srp client host state", "not registered")
+
+
+def browse_services(node):
+    return node.command("dns browse %s.default.service.arpa." % SERVICE_TYPE, timeout=30)
+
+
+def run_steady_load(args, nodes, recorder):
+    deadline = time.monotonic() + args.duration
+
+    def dns_worker():
+        while time.monotonic() < deadline:
+            recorder.measure("dns_browse", browse_services, random.choice(nodes))
+            time.sleep(args.dns_interval)
+
+    def rest_worker():
+        while time.monotonic() < deadline:
+            recorder.measure("rest_get", rest_get, args.rest_url + random.choice(REST_PATHS), 10)
+            time.sleep(args.rest_interval)
+
+    def diag_worker():
+        while time.monotonic() < deadline:
+            recorder.measure("rest_diagnostics", rest_get, args.rest_url + "/diagnostics", 60)
+            time.sleep(args.diag_interval)
+
+    workers = [dns_worker] * args.dns_clients + [rest_worker] * args.rest_clients + [diag_worker]
+
+    with ThreadPoolExecutor(max_workers=len(workers)) as executor:
+        for future in [executor.submit(worker) for worker in workers]:
+            future.result()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dataset", required=True, help="the active dataset TLVs of the network in hex")
+    parser.add_argument("--agent-pid", type=int, required=True, help="the process ID of otbr-agent")
+    parser.add_argument("--ot-cli-ftd", default="ot-cli-ftd", help="the path of the simulation FTD CLI")
+    parser.add_argument("--ot-cli-mtd", default="ot-cli-mtd", help="the path of the simulation MTD CLI")
+    parser.add_argument("--nodes", type=int, default=16, help="the number of simulated nodes")
+    parser.add_argument("--routers", type=int, default=8, help="the number of nodes which are FTDs")
+    parser.add_argument("--first-node-id", type=int, default=2, help="the simulation ID of the first node")
+    parser.add_argument("--concurrency", type=int, default=8, help="the number of nodes joining at the same time")
+    parser.add_argument("--duration", type=float, default=60, help="the duration of the steady load in seconds")
+    parser.add_argument("--dns-clients", type=int, default=4, help="the number of concurrent DNS-SD clients")
+    parser.add_argument("--dns-interval", type=float, default=0.5, help="the interval of each DNS-SD client")
+    parser.add_argument("--rest-url", default="http://127.0.0.1:8081", help="the URL of the REST API")
+    parser.add_argument("--rest-clients", type=int, default=4, help="the number of concurrent REST clients")
+    parser.add_argument("--rest-interval", type=float, default=0.1, help="the interval of each REST client")
+    parser.add_argument("--diag-interval", type=float, default=10, help="the interval of network diagnostics")
+    parser.add_argument("--output", help="the file to write the JSON report to, the standard output by default")
+    args = parser.parse_args()
+
+    recorder = Recorder()
+    monitor = AgentMonitor(args.agent_pid)
+    nodes = []
+
+    monitor.start()
+
+    try:
+        for i in range(args.nodes):
+            cli = args.ot_cli_ftd if i < args.routers else args.ot_cli_mtd
+            nodes.append(Node(args.first_node_id + i, cli))
+
+        with ThreadPoolExecutor(max_workers=args.concurrency) as executor:
+            list(executor.map(lambda node: recorder.measure("join", join_node, node, args.dataset), nodes))
+            list(executor.map(lambda node: recorder.measure("srp_register", register_service, node), nodes))
+
+        run_steady_load(args, nodes, recorder)
+    finally:
+        monitor.stop()
+        for node in nodes:
+            node.close()
+
+    report = {
+        "nodes": args.nodes,
+        "routers": min(args.routers, args.nodes),
+        "duration_s": args.duration,
+        "operations": recorder.report(),
+        "agent": monitor.report(),
+    }
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(report, f, indent=2)
+    else:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+
+
+if __name__ == "__main__":
+    main()
@@ -47,6 +47,41 @@ def get_data_from_url(url, result, index):
     result[index] = data
 
 
+def get_ndjson_from_url(url, result, index):
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    assert (response.headers["Content-Type"] == "application/x-ndjson")
+    body = response.read().decode()
+    result[index] = [json.loads(line) for line in body.splitlines() if line]
+
+
+def get_events_from_url(url, result, index):
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    assert (response.headers["Content-Type"] == "text/event-stream")
+
+    # The stream starts with an event for each subscribed resource.
+    events = {}
+    name = None
+    while len(events) < 2:
+        line = response.readline().decode().rstrip("\n")
+        if line.startswith("event: "):
+            name = line[len("event: "):]
+        elif line.startswith("data: "):
+            events[name] = json.loads(line[len("data: "):])
+
+    response.close()
+    result[index] = events
+
+
+def post_batch_to_url(url, result, index):
+    batch = ["/node/rloc16", "/node/state", {"Method": "GET", "Path": "/node/ext-panid"}, "/hello"]
+    request = urllib.request.Request(url,
+                                     data=json.dumps(batch).encode(),
+                                     headers={"Content-Type": "application/json"},
+                                     method="POST")
+    response = urllib.request.urlopen(request)
+    result[index] = json.loads(response.read())
+
+
 def get_error_from_url(url, result, index):
     try:
         urllib.request.urlopen(urllib.request.Request(url))
@@ -296,6 +331,39 @@ def node_ext_panid_check(data):
     return True
 
 
+def topology_check(data):
+    assert data is not None
+
+    assert (type(data["Version"]) == int)
+    assert (type(data["RefreshInterval"]) == int)
+    assert (type(data["Nodes"]) == list)
+
+    for node in data["Nodes"]:
+        expected_keys = [
+            "Rloc16", "ExtAddress", "Mode", "Age", "Routes", "Children"
+        ]
+        expected_value_type = [int, str, dict, int, list, list]
+        expected_check_dict = dict(zip(expected_keys, expected_value_type))
+
+        for key, value in expected_check_dict.items():
+            assert (key in node)
+            assert (type(node[key]) == value)
+
+        assert (re.match(r'^[A-F0-9]{16}$', node["ExtAddress"]) is not None)
+
+        for route in node["Routes"]:
+            assert (type(route["RouterRloc16"]) == int)
+            assert (route["RouterRloc16"] & 0x1ff == 0)
+            assert (0 <= route["LinkQualityIn"] <= 3)
+            assert (0 <= route["LinkQualityOut"] <= 3)
+
+        for child in node["Children"]:
+            assert (child["Rloc16"] & 0xfc00 == node["Rloc16"])
+            assert (type(child["Mode"]) == dict)
+
+    return True
+
+
 def node_test(thread_num):
     url = rest_api_addr + "/node"
 
@@ -428,6 +496,81 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def diagnostics_stream_test(thread_num):
+    url = rest_api_addr + "/diagnostics?stream=true"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_ndjson_from_url, url, thread_num, response_data)
+
+    for data in response_data:
+        diagnostics_check(data)
+
+    has_content = [len(data) > 0 for data in response_data].count(True)
+
+    print(" /diagnostics?stream=true : all {}, has content {} ".format(
+        thread_num, has_content))
+
+
+def topology_test(thread_num):
+    url = rest_api_addr + "/topology"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [topology_check(data) for data in response_data].count(True)
+
+    print(" /topology : all {}, valid {} ".format(thread_num, valid))
+
+
+def events_check(data):
+    assert data is not None
+
+    assert (set(data.keys()) == {"state", "rloc16"})
+    assert (0 <= data["state"] <= 4)
+    assert (type(data["rloc16"]) == int)
+
+    return True
+
+
+def events_test(thread_num):
+    url = rest_api_addr + "/events?resources=state,rloc16"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_events_from_url, url, thread_num, response_data)
+
+    valid = [events_check(data) for data in response_data].count(True)
+
+    print(" /events : all {}, valid {} ".format(thread_num, valid))
+
+
+def batch_check(data):
+    assert data is not None
+
+    assert ([item["Path"] for item in data] == ["/node/rloc16", "/node/state", "/node/ext-panid", "/hello"])
+    assert ([item["Status"] for item in data] == [200, 200, 200, 404])
+    assert (type(data[0]["Body"]) == int)
+    assert (0 <= data[1]["Body"] <= 4)
+    assert (len(data[2]["Body"]) == 16)
+    assert (data[3]["Body"]["ErrorCode"] == 404)
+
+    return True
+
+
+def batch_test(thread_num):
+    url = rest_api_addr + "/batch"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(post_batch_to_url, url, thread_num, response_data)
+
+    valid = [batch_check(data) for data in response_data].count(True)
+
+    print(" /batch : all {}, valid {} ".format(thread_num, valid))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -451,6 +594,10 @@ def main():
     node_num_of_router_test(200)
     node_ext_panid_test(200)
     diagnostics_test(20)
+    diagnostics_stream_test(20)
+    topology_test(200)
+    events_test(20)
+    batch_test(20)
     error_test(10)
 
     return 0
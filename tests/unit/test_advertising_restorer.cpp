@@ -0,0 +1,229 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sdp_proxy/advertising_restorer.hpp"
+
+#include <functional>
+
+#include <stdio.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_manager.hpp"
+#include "mdns/mdns_mock.hpp"
+
+using otbr::AdvertisingRestorer;
+using otbr::AdvertisingSnapshot;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherMock;
+
+static const char kSnapshotPath[] = "test_advertising_restorer.bin";
+static const char kServiceType[]  = "_test._udp";
+
+namespace {
+
+class TestPublisher : public PublisherMock
+{
+public:
+    TestPublisher(void)
+        : PublisherMock([](Publisher::State) {}, PublisherMock::Config())
+    {
+        SuccessOrDie(Start(), "Failed to start the publisher");
+    }
+
+    bool HasHost(const std::string &aName) { return FindHostRegistration(aName) != nullptr; }
+    bool HasService(const std::string &aName) { return FindServiceRegistration(aName, kServiceType) != nullptr; }
+};
+
+} // namespace
+
+static void RunMainloopUntil(const std::function<bool(void)> &aCondition)
+{
+    auto deadline = otbr::Clock::now() + otbr::Milliseconds(5000);
+
+    while (!aCondition() && otbr::Clock::now() < deadline)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {1, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+}
+
+static AdvertisingSnapshot::Host MakeHost(const std::string                         &aName,
+                                          AdvertisingSnapshot::WallClock::time_point aExpireTime,
+                                          const std::vector<std::string>            &aInstanceNames)
+{
+    AdvertisingSnapshot::Host host;
+
+    host.mName       = aName;
+    host.mExpireTime = aExpireTime;
+    host.mAddresses.push_back(otbr::Ip6Address(1));
+
+    for (const std::string &instanceName : aInstanceNames)
+    {
+        host.mServices.push_back({instanceName, kServiceType, {}, 12345, {3, 'a', '=', '1'}});
+    }
+
+    return host;
+}
+
+static void SaveSnapshot(const std::vector<AdvertisingSnapshot::Host> &aHosts)
+{
+    AdvertisingSnapshot snapshot(kSnapshotPath);
+
+    for (const AdvertisingSnapshot::Host &host : aHosts)
+    {
+        snapshot.SetHost(host);
+    }
+
+    SuccessOrDie(snapshot.Save(), "Failed to save the snapshot");
+}
+
+TEST_GROUP(AdvertisingRestorer)
+{
+    void teardown(void) { remove(kSnapshotPath); }
+};
+
+TEST(AdvertisingRestorer, TestPublishRestoredHosts)
+{
+    auto          now = AdvertisingSnapshot::WallClock::now();
+    TestPublisher publisher;
+
+    SaveSnapshot({MakeHost("host1", now + otbr::Seconds(60), {"service1", "service2"})});
+
+    AdvertisingRestorer restorer(publisher);
+
+    restorer.Load(kSnapshotPath);
+    CHECK_TRUE(restorer.IsRestored("host1"));
+
+    restorer.PublishRestoredHosts();
+    CHECK_TRUE(publisher.HasHost("host1"));
+    CHECK_TRUE(publisher.HasService("service1"));
+    CHECK_TRUE(publisher.HasService("service2"));
+}
+
+TEST(AdvertisingRestorer, TestReconcile)
+{
+    auto          now = AdvertisingSnapshot::WallClock::now();
+    TestPublisher publisher;
+
+    SaveSnapshot({MakeHost("host1", now + otbr::Seconds(60), {"service1", "service2"}),
+                  MakeHost("host2", now + otbr::Seconds(60), {"service3"})});
+
+    AdvertisingRestorer restorer(publisher);
+
+    restorer.Load(kSnapshotPath);
+    restorer.PublishRestoredHosts();
+
+    // The services which are not registered again are unpublished.
+    restorer.UpdateHost(MakeHost("host1", now + otbr::Seconds(120), {"service1"}));
+    CHECK_FALSE(restorer.IsRestored("host1"));
+    CHECK_TRUE(publisher.HasService("service1"));
+    CHECK_FALSE(publisher.HasService("service2"));
+    CHECK_EQUAL(1, restorer.GetSnapshot().FindHost("host1")->mServices.size());
+
+    // All the services of a deleted host are unpublished.
+    restorer.RemoveHost("host2");
+    CHECK_FALSE(restorer.IsRestored("host2"));
+    CHECK_FALSE(publisher.HasService("service3"));
+    CHECK_TRUE(restorer.GetSnapshot().FindHost("host2") == nullptr);
+}
+
+TEST(AdvertisingRestorer, TestExpireRestoredHosts)
+{
+    auto          now = AdvertisingSnapshot::WallClock::now();
+    TestPublisher publisher;
+
+    // The expire time is saved in seconds, so the lease of host1 expires in one to two seconds.
+    SaveSnapshot({MakeHost("host1", now + otbr::Seconds(2), {"service1"}),
+                  MakeHost("host2", now + otbr::Seconds(60), {"service2"})});
+
+    AdvertisingRestorer restorer(publisher);
+
+    restorer.Load(kSnapshotPath);
+    restorer.PublishRestoredHosts();
+    CHECK_TRUE(publisher.HasHost("host1"));
+
+    RunMainloopUntil([&restorer]() { return !restorer.IsRestored("host1"); });
+    CHECK_FALSE(restorer.IsRestored("host1"));
+    CHECK_FALSE(publisher.HasHost("host1"));
+    CHECK_FALSE(publisher.HasService("service1"));
+    CHECK_TRUE(restorer.IsRestored("host2"));
+    CHECK_TRUE(publisher.HasService("service2"));
+
+    restorer.Flush();
+
+    {
+        AdvertisingSnapshot snapshot(kSnapshotPath);
+
+        CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load());
+        CHECK_TRUE(snapshot.FindHost("host1") == nullptr);
+        CHECK_TRUE(snapshot.FindHost("host2") != nullptr);
+    }
+}
+
+TEST(AdvertisingRestorer, TestFlush)
+{
+    auto          now = AdvertisingSnapshot::WallClock::now();
+    TestPublisher publisher;
+
+    remove(kSnapshotPath);
+
+    {
+        AdvertisingRestorer restorer(publisher);
+        AdvertisingSnapshot snapshot(kSnapshotPath);
+
+        restorer.Load(kSnapshotPath);
+        restorer.UpdateHost(MakeHost("host1", now + otbr::Seconds(60), {"service1"}));
+
+        // The pending changes are written on flush, without waiting for the coalescing delay.
+        restorer.Flush();
+        CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load());
+        CHECK_TRUE(snapshot.FindHost("host1") != nullptr);
+
+        restorer.UpdateHost(MakeHost("host2", now + otbr::Seconds(60), {"service2"}));
+    }
+
+    {
+        AdvertisingSnapshot snapshot(kSnapshotPath);
+
+        // The pending changes are written on destruction.
+        CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Load());
+        CHECK_TRUE(snapshot.FindHost("host1") != nullptr);
+        CHECK_TRUE(snapshot.FindHost("host2") != nullptr);
+    }
+}
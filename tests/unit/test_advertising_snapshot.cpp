@@ -0,0 +1,137 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "sdp_proxy/advertising_snapshot.hpp"
+
+#include <fstream>
+
+#include <stdio.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::AdvertisingSnapshot;
+
+static const char kSnapshotPath[] = "test_advertising_snapshot.bin";
+
+static otbr::Ip6Address MakeAddress(const char *aString)
+{
+    otbr::Ip6Address address;
+
+    otbr::Ip6Address::FromString(aString, address);
+
+    return address;
+}
+
+static AdvertisingSnapshot::Host MakeHost(const std::string                         &aName,
+                                          AdvertisingSnapshot::WallClock::time_point aExpireTime)
+{
+    AdvertisingSnapshot::Host    host;
+    AdvertisingSnapshot::Service service;
+
+    service.mInstanceName = aName + "-service";
+    service.mType         = "_test._udp";
+    service.mSubTypes     = {"_printer"};
+    service.mPort         = 12345;
+    service.mTxtData      = {3, 'a', '=', '1'};
+
+    host.mName       = aName;
+    host.mExpireTime = aExpireTime;
+    host.mAddresses.push_back(MakeAddress("fd00::1"));
+    host.mServices.push_back(service);
+
+    return host;
+}
+
+TEST_GROUP(AdvertisingSnapshot)
+{
+    void teardown(void) { remove(kSnapshotPath); }
+};
+
+TEST(AdvertisingSnapshot, TestSaveAndLoad)
+{
+    auto                now = AdvertisingSnapshot::WallClock::now();
+    AdvertisingSnapshot snapshot(kSnapshotPath);
+    AdvertisingSnapshot restored(kSnapshotPath);
+
+    snapshot.SetHost(MakeHost("host1", now + otbr::Seconds(60)));
+    snapshot.SetHost(MakeHost("host2", now + otbr::Seconds(120)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, restored.Load(now));
+    CHECK_EQUAL(2, restored.GetHosts().size());
+
+    {
+        const AdvertisingSnapshot::Host *host = restored.FindHost("host1");
+
+        CHECK_TRUE(host != nullptr);
+        CHECK_EQUAL(1, host->mAddresses.size());
+        CHECK_TRUE(host->mAddresses[0] == MakeAddress("fd00::1"));
+        CHECK_EQUAL(1, host->mServices.size());
+        STRCMP_EQUAL("host1-service", host->mServices[0].mInstanceName.c_str());
+        STRCMP_EQUAL("_test._udp", host->mServices[0].mType.c_str());
+        CHECK_EQUAL(1, host->mServices[0].mSubTypes.size());
+        STRCMP_EQUAL("_printer", host->mServices[0].mSubTypes[0].c_str());
+        CHECK_EQUAL(12345, host->mServices[0].mPort);
+        CHECK_TRUE(host->mServices[0].mTxtData == std::vector<uint8_t>({3, 'a', '=', '1'}));
+        // The expire time is saved in seconds.
+        CHECK_TRUE(now + otbr::Seconds(60) - host->mExpireTime < otbr::Seconds(1));
+    }
+
+    // Hosts whose leases have expired are not restored.
+    CHECK_EQUAL(OTBR_ERROR_NONE, restored.Load(now + otbr::Seconds(90)));
+    CHECK_EQUAL(1, restored.GetHosts().size());
+    CHECK_TRUE(restored.FindHost("host2") != nullptr);
+}
+
+TEST(AdvertisingSnapshot, TestLoadMissingFile)
+{
+    AdvertisingSnapshot snapshot(kSnapshotPath);
+
+    remove(kSnapshotPath);
+    CHECK_EQUAL(OTBR_ERROR_NOT_FOUND, snapshot.Load());
+    CHECK_TRUE(snapshot.GetHosts().empty());
+}
+
+TEST(AdvertisingSnapshot, TestLoadCorruptedFile)
+{
+    auto                now = AdvertisingSnapshot::WallClock::now();
+    AdvertisingSnapshot snapshot(kSnapshotPath);
+    AdvertisingSnapshot restored(kSnapshotPath);
+
+    snapshot.SetHost(MakeHost("host1", now + otbr::Seconds(60)));
+    CHECK_EQUAL(OTBR_ERROR_NONE, snapshot.Save());
+
+    {
+        std::fstream file(kSnapshotPath, std::ios::binary | std::ios::in | std::ios::out);
+
+        file.seekp(12);
+        file.put('X');
+    }
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, restored.Load(now));
+    CHECK_TRUE(restored.GetHosts().empty());
+}
@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <functional>
+#include <string>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/dbus_dispatch_table.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::DBus::DBusDispatchTable;
+
+using Handler = std::function<int(void)>;
+
+TEST_GROUP(DBusDispatchTable){};
+
+TEST(DBusDispatchTable, TestAddAndFind)
+{
+    DBusDispatchTable<Handler> table;
+
+    CHECK_TRUE(table.Add("io.openthread.BorderRouter", "Attach", []() { return 1; }));
+    CHECK_TRUE(table.Add("io.openthread.BorderRouter", "Detach", []() { return 2; }));
+    CHECK_TRUE(table.Add("org.freedesktop.DBus.Properties", "Attach", []() { return 3; }));
+    CHECK_FALSE(table.Add("io.openthread.BorderRouter", "Attach", []() { return 4; }));
+
+    CHECK_EQUAL(1, (*table.Find("io.openthread.BorderRouter", "Attach"))());
+    CHECK_EQUAL(2, (*table.Find("io.openthread.BorderRouter", "Detach"))());
+    CHECK_EQUAL(3, (*table.Find("org.freedesktop.DBus.Properties", "Attach"))());
+
+    // "a.b" + "c" and "a" + "b.c" hash the same, but must not match.
+    CHECK_TRUE(table.Add("a.b", "c", []() { return 5; }));
+    CHECK_TRUE(table.Find("a", "b.c") == nullptr);
+    CHECK_EQUAL(5, (*table.Find("a.b", "c"))());
+
+    CHECK_TRUE(table.Find("io.openthread.BorderRouter", "Reset") == nullptr);
+    CHECK_TRUE(table.Find(nullptr, "Attach") == nullptr);
+    CHECK_TRUE(table.Find("io.openthread.BorderRouter", nullptr) == nullptr);
+}
+
+TEST(DBusDispatchTable, TestForEach)
+{
+    DBusDispatchTable<Handler> table;
+    int                        count = 0;
+    int                        sum   = 0;
+
+    table.Add("io.openthread.BorderRouter", "Rloc16", []() { return 1; });
+    table.Add("io.openthread.BorderRouter", "PanId", []() { return 2; });
+    table.Add("io.openthread.Other", "PanId", []() { return 4; });
+
+    CHECK_TRUE(table.HasInterface("io.openthread.BorderRouter"));
+    CHECK_FALSE(table.HasInterface("io.openthread"));
+
+    table.ForEach("io.openthread.BorderRouter", [&](const std::string &aName, const Handler &aHandler) {
+        OTBR_UNUSED_VARIABLE(aName);
+        ++count;
+        sum += aHandler();
+        return true;
+    });
+
+    CHECK_EQUAL(2, count);
+    CHECK_EQUAL(3, sum);
+}
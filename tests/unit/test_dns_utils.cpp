@@ -66,6 +66,19 @@ static void CheckSplitFullDnsName(const std::string &aFullName,
     CHECK_EQUAL(aServiceName, info.mServiceName);
     CHECK_EQUAL(aHostName, info.mHostName);
     CHECK_EQUAL(aDomain, info.mDomain);
+
+    for (const std::string &fullName : {aFullName, aFullName + "."})
+    {
+        DnsNameView view = SplitFullDnsNameView(fullName);
+
+        CHECK_EQUAL(aIsServiceInstance, view.IsServiceInstance());
+        CHECK_EQUAL(aIsService, view.IsService());
+        CHECK_EQUAL(aIsHost, view.IsHost());
+        CHECK_EQUAL(aInstanceName, view.mInstanceName.ToString());
+        CHECK_EQUAL(aServiceName, view.mServiceName.ToString());
+        CHECK_EQUAL(aHostName, view.mHostName.ToString());
+        CHECK_EQUAL(aDomain, view.mDomain.ToString() + ".");
+    }
 }
 
 TEST(DnsUtils, TestSplitFullDnsName)
@@ -95,3 +108,57 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestDnsLabelsEqual)
+{
+    CHECK_TRUE(DnsLabelsEqual("_meshcop._udp", "_MeshCoP._UDP"));
+    CHECK_TRUE(DnsLabelsEqual("", ""));
+    CHECK_FALSE(DnsLabelsEqual("_meshcop._udp", "_meshcop._tcp"));
+    CHECK_FALSE(DnsLabelsEqual("local", "local."));
+}
+
+TEST(DnsUtils, TestDnsName)
+{
+    static const uint8_t kWireName[] = {4, 'i', 'n', 's', '1', 5, '_', 'i', 'p', 'p', 's', 4, '_', 't', 'c', 'p',
+                                        5, 'l', 'o', 'c', 'a', 'l', 0};
+
+    DnsName name;
+    DnsName other;
+
+    CHECK_EQUAL(1, name.GetLength());
+    CHECK_EQUAL(0, name.GetLabelCount());
+    CHECK_EQUAL(".", name.ToString());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, name.AppendLabel("ins1"));
+    CHECK_EQUAL(OTBR_ERROR_NONE, name.AppendName("_ipps._tcp.local."));
+    CHECK_EQUAL(sizeof(kWireName), name.GetLength());
+    MEMCMP_EQUAL(kWireName, name.GetData(), sizeof(kWireName));
+    CHECK_EQUAL(4, name.GetLabelCount());
+    CHECK_EQUAL("ins1._ipps._tcp.local.", name.ToString());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, other.AppendName("INS1._IPPS._tcp.Local"));
+    CHECK_TRUE(name == other);
+
+    // Instance names may contain dots.
+    other = DnsName();
+    CHECK_EQUAL(OTBR_ERROR_NONE, other.AppendLabel("ins1._ipps"));
+    CHECK_EQUAL(OTBR_ERROR_NONE, other.AppendName("_tcp.local"));
+    CHECK_EQUAL(3, other.GetLabelCount());
+    CHECK_TRUE(name != other);
+
+    // Invalid labels leave the name unchanged.
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, other.AppendLabel(""));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, other.AppendName("abc..def"));
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, other.AppendLabel(std::string(DnsName::kMaxLabelLength + 1, 'a')));
+    CHECK_EQUAL("ins1._ipps._tcp.local.", other.ToString());
+
+    // The name including the root label can't exceed 255 bytes.
+    other = DnsName();
+    for (int i = 0; i < 3; i++)
+    {
+        CHECK_EQUAL(OTBR_ERROR_NONE, other.AppendLabel(std::string(DnsName::kMaxLabelLength, 'a')));
+    }
+    CHECK_EQUAL(OTBR_ERROR_NONE, other.AppendLabel(std::string(61, 'a')));
+    CHECK_EQUAL(DnsName::kMaxLength, other.GetLength());
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, other.AppendLabel("a"));
+}
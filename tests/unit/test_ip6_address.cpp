@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/types.hpp"
+
+#include <random>
+#include <unordered_set>
+
+#include <arpa/inet.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+
+static const char *const kAddressStrings[] = {
+    "::",
+    "::1",
+    "1::",
+    "fe80::1",
+    "fe80::a8bb:ccff:fedd:eeff",
+    "2001:db8::1:0:0:1",
+    "2001:db8:0:0:1::1",
+    "2001:db8:0:1:1:1:1:1",
+    "fd11:22:0:0:c5d4:1e4:6c0a:8e8a",
+    "ff02::1:ff00:0",
+    "1:2:3:4:5:6:7:8",
+    "::ffff:192.0.2.128",
+    "::192.0.2.1",
+    "::ffff:0:0",
+    "0:0:1::",
+};
+
+// Checks the address converted by both the libc and the `Ip6Address` methods.
+static void CheckAddress(const uint8_t *aBytes)
+{
+    char       expected[INET6_ADDRSTRLEN];
+    char       buffer[Ip6Address::kStringSize];
+    Ip6Address address;
+    Ip6Address parsed;
+
+    memcpy(address.m8, aBytes, sizeof(address.m8));
+
+    CHECK(inet_ntop(AF_INET6, aBytes, expected, sizeof(expected)) != nullptr);
+    STRCMP_EQUAL(expected, address.ToString(buffer));
+    CHECK_EQUAL(std::string(expected), address.ToString());
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(expected, parsed));
+    CHECK_TRUE(parsed == address);
+}
+
+TEST_GROUP(Ip6Address){};
+
+TEST(Ip6Address, TestToStringAndFromString)
+{
+    std::mt19937 random(0);
+
+    for (const char *string : kAddressStrings)
+    {
+        uint8_t bytes[16];
+
+        CHECK_EQUAL(1, inet_pton(AF_INET6, string, bytes));
+        CheckAddress(bytes);
+    }
+
+    // Random addresses with random zero groups to exercise the zero compression.
+    for (int i = 0; i < 100000; i++)
+    {
+        uint8_t  bytes[16];
+        uint32_t zeroGroups = random();
+
+        for (int j = 0; j < 16; j += 2)
+        {
+            uint32_t value = random();
+
+            bytes[j]     = (zeroGroups & (1u << (j / 2))) ? 0 : static_cast<uint8_t>(value);
+            bytes[j + 1] = (zeroGroups & (1u << (j / 2))) ? 0 : static_cast<uint8_t>(value >> 8);
+        }
+
+        CheckAddress(bytes);
+    }
+}
+
+TEST(Ip6Address, TestFromStringFormats)
+{
+    static const char *const kValidStrings[] = {
+        "FE80::A8BB:CCFF:FEDD:EEFF",
+        "0000:0000:0000:0000:0000:0000:0000:0001",
+        "1:2:3:4:5:6::8",
+        "1:2:3:4:5:6:7::",
+        "::2:3:4:5:6:7:8",
+        "1::2:3.4.5.6",
+        "::0.0.0.0",
+    };
+    static const char *const kInvalidStrings[] = {
+        "",
+        ":",
+        ":::",
+        "1:::2",
+        "1::2::3",
+        ":1::2",
+        "1::2:",
+        "1:2:3:4:5:6:7",
+        "1:2:3:4:5:6:7:8:9",
+        "1:2:3:4:5:6:7:8::",
+        "12345::",
+        "g::",
+        "::1.2.3",
+        "::1.2.3.4.5",
+        "::1.2.3.256",
+        "::01.2.3.4",
+        "::1.2.3.4:5",
+        "1:2:3:4:5:6:7:1.2.3.4",
+        "1::2 ",
+        " ::1",
+        "::1/64",
+    };
+
+    for (const char *string : kValidStrings)
+    {
+        uint8_t    expected[16];
+        Ip6Address address;
+
+        CHECK_EQUAL(1, inet_pton(AF_INET6, string, expected));
+        CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(string, address));
+        MEMCMP_EQUAL(expected, address.m8, sizeof(expected));
+    }
+
+    for (const char *string : kInvalidStrings)
+    {
+        uint8_t    expected[16];
+        Ip6Address address;
+
+        CHECK_EQUAL(0, inet_pton(AF_INET6, string, expected));
+        CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, Ip6Address::FromString(string, address));
+    }
+}
+
+TEST(Ip6Address, TestPrefixToString)
+{
+    Ip6Prefix prefix;
+    char      buffer[Ip6Prefix::kStringSize];
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fd00:1234::", prefix.mPrefix));
+    prefix.mLength = 64;
+    STRCMP_EQUAL("fd00:1234::/64", prefix.ToString(buffer));
+
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                Ip6Address::FromString("ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255", prefix.mPrefix));
+    prefix.mLength = 128;
+    CHECK_EQUAL("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff/128", prefix.ToString());
+}
+
+TEST(Ip6Address, TestHash)
+{
+    std::unordered_set<Ip6Address> addresses;
+    Ip6Address                     address;
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        CHECK_TRUE(addresses.insert(Ip6Address(i)).second);
+    }
+
+    CHECK_FALSE(addresses.insert(Ip6Address(999)).second);
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString("fe80::1", address));
+    CHECK_TRUE(addresses.find(address) == addresses.end());
+    CHECK_TRUE(addresses.find(Ip6Address(123)) != addresses.end());
+}
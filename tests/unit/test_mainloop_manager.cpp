@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/mainloop_manager.hpp"
+
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop.hpp"
+
+namespace {
+
+class TestProcessor : public otbr::MainloopProcessor
+{
+public:
+    TestProcessor(std::string &aTrace, char aName, Priority aPriority = kPriorityNormal)
+        : MainloopProcessor(aPriority)
+        , mTrace(aTrace)
+        , mName(aName)
+    {
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override { OTBR_UNUSED_VARIABLE(aMainloop); }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        OTBR_UNUSED_VARIABLE(aMainloop);
+
+        mTrace.push_back(mName);
+    }
+
+    using MainloopProcessor::ProcessWithinBudget;
+    using MainloopProcessor::TakeWithinBudget;
+
+private:
+    std::string &mTrace;
+    char         mName;
+};
+
+} // namespace
+
+TEST_GROUP(MainloopManager){};
+
+TEST(MainloopManager, TestProcessInOrderOfPriority)
+{
+    std::string           trace;
+    otbr::MainloopContext mainloop;
+    TestProcessor         a(trace, 'a');
+    TestProcessor         b(trace, 'b');
+    TestProcessor         controller(trace, 'c', otbr::MainloopProcessor::kPriorityHigh);
+    TestProcessor         d(trace, 'd');
+
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+
+    // The high priority processor goes first, and the others keep the order of creation.
+    STRCMP_EQUAL("cabd", trace.c_str());
+}
+
+TEST(MainloopManager, TestProcessWithinBudget)
+{
+    std::string   trace;
+    TestProcessor processor(trace, 'a');
+    uint32_t      pending    = 40;
+    uint32_t      processed  = 0;
+    auto          processOne = [&]() {
+        processed++;
+        return --pending > 0;
+    };
+
+    // A flood of 40 messages is dispatched in two iterations with the budget of the D-Bus agent.
+    CHECK_TRUE(processor.ProcessWithinBudget(32, processOne));
+    CHECK_EQUAL(32, processed);
+    CHECK_EQUAL(1, processor.GetDeferredWorkCount());
+    CHECK_FALSE(processor.ProcessWithinBudget(32, processOne));
+    CHECK_EQUAL(40, processed);
+    CHECK_EQUAL(1, processor.GetDeferredWorkCount());
+
+    // No work is left when the last unit of work uses up the budget.
+    pending = 32;
+    CHECK_FALSE(processor.ProcessWithinBudget(32, processOne));
+    CHECK_EQUAL(1, processor.GetDeferredWorkCount());
+}
+
+TEST(MainloopManager, TestTakeWithinBudget)
+{
+    std::string      trace;
+    TestProcessor    processor(trace, 'a');
+    std::vector<int> items;
+    size_t           nextOffset = 0;
+
+    // Items within the budget are all taken.
+    items = {0, 1, 2};
+    CHECK_FALSE(processor.TakeWithinBudget(items, 16, nextOffset));
+    CHECK_EQUAL(3, items.size());
+    CHECK_EQUAL(0, nextOffset);
+    CHECK_EQUAL(0, processor.GetDeferredWorkCount());
+
+    // 20 ready refs with the budget of the mDNSResponder publisher are taken from a rotating offset.
+    for (int round = 0; round < 3; round++)
+    {
+        items.clear();
+        for (int i = 0; i < 20; i++)
+        {
+            items.push_back(i);
+        }
+
+        CHECK_TRUE(processor.TakeWithinBudget(items, 16, nextOffset));
+        CHECK_EQUAL(16, items.size());
+        CHECK_EQUAL((round * 16) % 20, items.front());
+    }
+
+    CHECK_EQUAL(3, processor.GetDeferredWorkCount());
+}
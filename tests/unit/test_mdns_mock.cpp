@@ -0,0 +1,295 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/mdns_mock.hpp"
+
+#include <sstream>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_manager.hpp"
+
+using otbr::Ip6Address;
+using otbr::Milliseconds;
+using otbr::Mdns::Publisher;
+using otbr::Mdns::PublisherMock;
+using otbr::Mdns::PublisherReplayer;
+
+static void RunMainloopUntil(const std::function<bool(void)> &aCondition)
+{
+    auto deadline = otbr::Clock::now() + Milliseconds(5000);
+
+    while (!aCondition() && otbr::Clock::now() < deadline)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {1, 0};
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+               &mainloop.mTimeout);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+}
+
+static Publisher::DiscoveredInstanceInfo MakeRemoteInstance(const std::string &aName)
+{
+    Publisher::DiscoveredInstanceInfo instanceInfo;
+
+    instanceInfo.mNetifIndex = 1;
+    instanceInfo.mName       = aName;
+    instanceInfo.mHostName   = "remote.local.";
+    instanceInfo.mPort       = 49152;
+    instanceInfo.mTtl        = 120;
+
+    return instanceInfo;
+}
+
+TEST_GROUP(MdnsMock){};
+
+TEST(MdnsMock, TestPublishImmediately)
+{
+    PublisherMock::Config     config;
+    PublisherMock             publisher([](Publisher::State) {}, config);
+    std::vector<Ip6Address>   addresses{Ip6Address(1)};
+    int                       succeeded = 0;
+    otbrError                 error     = OTBR_ERROR_NONE;
+    Publisher::ResultCallback callback  = [&](otbrError aError) {
+        error = aError;
+        ++succeeded;
+    };
+
+    publisher.PublishHost("host", addresses, [&](otbrError aError) { error = aError; });
+    CHECK_EQUAL(OTBR_ERROR_INVALID_STATE, error);
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+    CHECK_TRUE(publisher.IsStarted());
+
+    publisher.PublishHost("host", addresses, std::move(callback));
+    CHECK_EQUAL(OTBR_ERROR_NONE, error);
+    CHECK_EQUAL(1, succeeded);
+
+    publisher.PublishService("host", "instance", "_test._udp", {}, 12345, {{"key", "value"}},
+                             [&](otbrError aError) {
+                                 error = aError;
+                                 ++succeeded;
+                             });
+    CHECK_EQUAL(OTBR_ERROR_NONE, error);
+    CHECK_EQUAL(2, succeeded);
+
+    publisher.UnpublishService("instance", "_test._udp", [&](otbrError aError) { error = aError; });
+    CHECK_EQUAL(OTBR_ERROR_NONE, error);
+
+    publisher.Stop();
+    CHECK_FALSE(publisher.IsStarted());
+}
+
+TEST(MdnsMock, TestPublishFailure)
+{
+    PublisherMock::Config config;
+    int                   failed = 0;
+
+    config.mFailureRate  = 100;
+    config.mFailureError = OTBR_ERROR_DUPLICATED;
+
+    PublisherMock publisher([](Publisher::State) {}, config);
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+
+    for (int i = 0; i < 10; i++)
+    {
+        publisher.PublishService("", "instance" + std::to_string(i), "_test._udp", {}, 12345, {},
+                                 [&](otbrError aError) {
+                                     CHECK_EQUAL(OTBR_ERROR_DUPLICATED, aError);
+                                     ++failed;
+                                 });
+    }
+
+    CHECK_EQUAL(10, failed);
+}
+
+TEST(MdnsMock, TestLatency)
+{
+    PublisherMock::Config config;
+    bool                  done  = false;
+    otbrError             error = OTBR_ERROR_MDNS;
+
+    config.mLatency = Milliseconds(20);
+
+    PublisherMock publisher([](Publisher::State) {}, config);
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+
+    publisher.PublishService("", "instance", "_test._udp", {}, 12345, {}, [&](otbrError aError) {
+        error = aError;
+        done  = true;
+    });
+    CHECK_FALSE(done);
+
+    RunMainloopUntil([&]() { return done; });
+    CHECK_TRUE(done);
+    CHECK_EQUAL(OTBR_ERROR_NONE, error);
+}
+
+TEST(MdnsMock, TestDiscovery)
+{
+    PublisherMock::Config             config;
+    PublisherMock                     publisher([](Publisher::State) {}, config);
+    std::set<std::string>             instances;
+    std::vector<Ip6Address>           hostAddresses;
+    Publisher::DiscoveredInstanceInfo localInstance;
+
+    publisher.AddSubscriptionCallbacks(
+        [&](const std::string &aType, const Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
+            CHECK_TRUE(aType == "_test._udp");
+            instances.insert(aInstanceInfo.mName);
+
+            if (aInstanceInfo.mName == "local")
+            {
+                localInstance = aInstanceInfo;
+            }
+        },
+        [&](const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo) {
+            CHECK_TRUE(aHostName == "host");
+            hostAddresses = aHostInfo.mAddresses;
+        });
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+
+    publisher.AddRemoteService("_test._udp", MakeRemoteInstance("remote1"));
+    publisher.AddRemoteService("_other._udp", MakeRemoteInstance("other"));
+    publisher.PublishHost("host", {Ip6Address(1)}, [](otbrError) {});
+    publisher.PublishService("host", "local", "_test._udp", {}, 12345, {{"key", "value"}}, [](otbrError) {});
+
+    publisher.SubscribeService("_test._udp", "");
+    CHECK_EQUAL(2, instances.size());
+    CHECK_EQUAL(1, instances.count("local"));
+    CHECK_EQUAL(1, instances.count("remote1"));
+    CHECK_TRUE(localInstance.mHostName == "host.local.");
+    CHECK_EQUAL(12345, localInstance.mPort);
+    CHECK_EQUAL(1, localInstance.mAddresses.size());
+
+    // New instances are discovered by the subscribers.
+    publisher.AddRemoteService("_test._udp", MakeRemoteInstance("remote2"));
+    CHECK_EQUAL(1, instances.count("remote2"));
+
+    publisher.UnsubscribeService("_test._udp", "");
+    publisher.AddRemoteService("_test._udp", MakeRemoteInstance("remote3"));
+    CHECK_EQUAL(0, instances.count("remote3"));
+
+    publisher.SubscribeHost("host");
+    CHECK_EQUAL(1, hostAddresses.size());
+}
+
+TEST(MdnsMock, TestReplay)
+{
+    PublisherMock::Config config;
+    PublisherMock         publisher([](Publisher::State) {}, config);
+    PublisherReplayer     replayer(publisher);
+    std::istringstream    trace("# A trace with all the operations\n"
+                                "subscribe-service _test._udp\n"
+                                "publish-host host fd00::1 fd00::2\n"
+                                "publish-service host instance1 _test._udp 12345 key=value\n"
+                                "publish-service - instance2 _test._udp 12346\n"
+                                "\n"
+                                "subscribe-host host\n"
+                                "unsubscribe-host host\n"
+                                "unpublish-service instance1 _test._udp\n"
+                                "unsubscribe-service _test._udp\n"
+                                "unpublish-host host\n");
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+    SuccessOrDie(replayer.Load(trace), "Failed to load the trace");
+
+    replayer.Replay();
+    CHECK_EQUAL(9, replayer.GetCounters().mOperations);
+    CHECK_EQUAL(9, replayer.GetCounters().mSucceeded);
+    CHECK_EQUAL(0, replayer.GetCounters().mFailed);
+    CHECK_EQUAL(0, replayer.GetNumPending());
+    CHECK_EQUAL(2, replayer.GetCounters().mInstances);
+    CHECK_EQUAL(1, replayer.GetCounters().mHosts);
+}
+
+TEST(MdnsMock, TestReplayWithLatency)
+{
+    PublisherMock::Config config;
+    std::ostringstream    trace;
+
+    config.mLatency     = Milliseconds(1);
+    config.mFailureRate = 50;
+
+    PublisherMock     publisher([](Publisher::State) {}, config);
+    PublisherReplayer replayer(publisher);
+
+    for (int i = 0; i < 100; i++)
+    {
+        trace << "publish-service - instance" << i << " _test._udp " << 10000 + i << "\n";
+    }
+
+    SuccessOrDie(publisher.Start(), "Failed to start the publisher");
+    {
+        std::istringstream input(trace.str());
+
+        SuccessOrDie(replayer.Load(input), "Failed to load the trace");
+    }
+
+    replayer.Replay();
+    CHECK_EQUAL(100, replayer.GetNumPending());
+
+    RunMainloopUntil([&]() { return replayer.GetNumPending() == 0; });
+    CHECK_EQUAL(0, replayer.GetNumPending());
+    CHECK_TRUE(replayer.GetCounters().mFailed > 0);
+    CHECK_TRUE(replayer.GetCounters().mSucceeded > 0);
+}
+
+TEST(MdnsMock, TestReplayInvalidTrace)
+{
+    PublisherMock::Config config;
+    PublisherMock         publisher([](Publisher::State) {}, config);
+    PublisherReplayer     replayer(publisher);
+    const char           *invalidTraces[] = {
+        "publish-host\n",
+        "publish-host host not-an-address\n",
+        "publish-service host instance _test._udp 70000\n",
+        "publish-service host instance _test._udp 12345 novalue\n",
+        "unpublish-service instance\n",
+        "unpublish-host host extra\n",
+        "resolve-service _test._udp\n",
+    };
+
+    for (const char *invalidTrace : invalidTraces)
+    {
+        std::istringstream trace(invalidTrace);
+
+        CHECK_EQUAL(OTBR_ERROR_PARSE, replayer.Load(trace));
+    }
+}
@@ -0,0 +1,210 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/move_only_function.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <stdlib.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/callback.hpp"
+#include "common/task_runner.hpp"
+
+using otbr::MoveOnlyFunction;
+
+// A callable which counts its heap allocations by the class-specific allocation functions, which are also used by
+// `std::function`.
+template <size_t kSize> struct CountedCallable
+{
+    static void *operator new(size_t aSize)
+    {
+        sAllocations++;
+        return malloc(aSize);
+    }
+
+    static void operator delete(void *aPtr)
+    {
+        sFrees++;
+        free(aPtr);
+    }
+
+    int  operator()(int aValue) const { return aValue + mPayload[0]; }
+    void operator()(void) const { sCalls++; }
+
+    int mPayload[kSize / sizeof(int)];
+
+    static int sAllocations;
+    static int sFrees;
+    static int sCalls;
+};
+
+template <size_t kSize> int CountedCallable<kSize>::sAllocations = 0;
+template <size_t kSize> int CountedCallable<kSize>::sFrees       = 0;
+template <size_t kSize> int CountedCallable<kSize>::sCalls       = 0;
+
+// The size of a typical capture: `this`, a string and a callback.
+typedef CountedCallable<48> SmallCallable;
+
+// Too large to be stored inline.
+typedef CountedCallable<MoveOnlyFunction<void(void)>::kInlineSize + 16> LargeCallable;
+
+// A callable which can't be copied.
+struct MoveOnlyCallable
+{
+    int operator()(int aValue) const { return *mFactor * aValue; }
+
+    std::unique_ptr<int> mFactor;
+};
+
+TEST_GROUP(MoveOnlyFunction){};
+
+TEST(MoveOnlyFunction, TestEmpty)
+{
+    void (*nullPointer)(void) = nullptr;
+
+    std::function<void(void)>      emptyFunction;
+    MoveOnlyFunction<void(void)>   func;
+    MoveOnlyFunction<void(void)>   nullFunc = nullptr;
+    MoveOnlyFunction<void(void)>   nullPointerFunc(nullPointer);
+    MoveOnlyFunction<void(void)>   emptyFunctionFunc(emptyFunction);
+    otbr::OnceCallback<void(void)> emptyFunctionCallback(emptyFunction);
+
+    CHECK_TRUE(func == nullptr);
+    CHECK_TRUE(nullFunc == nullptr);
+    CHECK_TRUE(nullPointerFunc == nullptr);
+    CHECK_TRUE(emptyFunctionFunc == nullptr);
+    CHECK_TRUE(emptyFunctionCallback.IsNull());
+    CHECK_FALSE(static_cast<bool>(func));
+}
+
+TEST(MoveOnlyFunction, TestMoveOnlyCallable)
+{
+    MoveOnlyFunction<int(int)>            func = MoveOnlyCallable{std::unique_ptr<int>(new int(3))};
+    MoveOnlyFunction<int(int)>            moved;
+    MoveOnlyFunction<void(std::string &)> append = [](std::string &aString) { aString += "!"; };
+    std::string                           string = "hello";
+
+    CHECK_EQUAL(15, func(5));
+
+    moved = std::move(func);
+    CHECK_TRUE(func == nullptr);
+    CHECK_EQUAL(21, moved(7));
+
+    append(string);
+    CHECK_EQUAL("hello!", string);
+}
+
+TEST(MoveOnlyFunction, TestAllocations)
+{
+#ifdef __GLIBCXX__
+    // Baseline: libstdc++ heap-allocates a callable of this size with its `operator new`. Other standard
+    // libraries may store it inline or allocate through the global allocator instead.
+    SmallCallable::sAllocations = 0;
+
+    {
+        std::function<int(int)> func = SmallCallable{{1}};
+
+        CHECK_EQUAL(2, func(1));
+        CHECK_EQUAL(1, SmallCallable::sAllocations);
+    }
+#endif
+
+    SmallCallable::sAllocations = 0;
+    LargeCallable::sAllocations = 0;
+    LargeCallable::sFrees       = 0;
+
+    {
+        MoveOnlyFunction<int(int)> func = SmallCallable{{1}};
+        MoveOnlyFunction<int(int)> moved;
+
+        moved = std::move(func);
+        CHECK_EQUAL(2, moved(1));
+        CHECK_EQUAL(0, SmallCallable::sAllocations);
+    }
+
+    {
+        MoveOnlyFunction<int(int)> func  = LargeCallable{{1}};
+        MoveOnlyFunction<int(int)> moved = std::move(func);
+
+        CHECK_EQUAL(2, moved(1));
+        CHECK_EQUAL(1, LargeCallable::sAllocations);
+    }
+
+    CHECK_EQUAL(1, LargeCallable::sFrees);
+}
+
+TEST(MoveOnlyFunction, TestDestroyCallable)
+{
+    std::shared_ptr<int> counter = std::make_shared<int>(0);
+
+    {
+        MoveOnlyFunction<void(void)> func  = [counter]() { ++*counter; };
+        MoveOnlyFunction<void(void)> moved = std::move(func);
+
+        moved();
+        CHECK_EQUAL(2, counter.use_count());
+    }
+
+    CHECK_EQUAL(1, *counter);
+    CHECK_EQUAL(1, counter.use_count());
+}
+
+TEST(MoveOnlyFunction, TestOnceCallbackAndTaskRunner)
+{
+    otbr::MainloopContext        mainloop;
+    otbr::TaskRunner             taskRunner;
+    otbr::OnceCallback<int(int)> callback = MoveOnlyCallable{std::unique_ptr<int>(new int(3))};
+
+    CHECK_EQUAL(6, std::move(callback)(2));
+    CHECK_TRUE(callback.IsNull());
+
+    SmallCallable::sAllocations = 0;
+    SmallCallable::sCalls       = 0;
+
+    // Neither posting the tasks nor moving them through the task queue allocates them.
+    for (int i = 0; i < 10; i++)
+    {
+        taskRunner.Post(SmallCallable{{i}});
+    }
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 0};
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    taskRunner.Update(mainloop);
+    taskRunner.Process(mainloop);
+
+    CHECK_EQUAL(10, SmallCallable::sCalls);
+    CHECK_EQUAL(0, SmallCallable::sAllocations);
+}
@@ -46,3 +46,28 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
 }
+
+TEST(Pskc, TestComputePskcs)
+{
+    const uint8_t extpanids[][8] = {
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07},
+        {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88},
+        {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe},
+    };
+    const otbr::Psk::Pskc::Params params[] = {
+        {extpanids[0], "OpenThread", "123456"},
+        {extpanids[1], "OpenThread-1234", "0123456789abcdef"},
+        {extpanids[2], "Thread-BR", "a-passphrase-longer-than-a-block"},
+        {extpanids[0], "OpenThread", "123456"},
+    };
+    const uint8_t expected[][OT_PSKC_LENGTH] = {
+        {0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69},
+        {0xb0, 0x46, 0x36, 0x35, 0x55, 0x25, 0x8b, 0xfa, 0xc3, 0xd4, 0x56, 0x5b, 0x52, 0x3e, 0xb7, 0xb2},
+        {0xb3, 0xaa, 0xaf, 0xbb, 0xf1, 0xf5, 0xa1, 0x7e, 0x41, 0xb9, 0x5b, 0xdb, 0xd3, 0x94, 0xae, 0xc6},
+        {0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69},
+    };
+    uint8_t pskcs[4][OT_PSKC_LENGTH];
+
+    otbr::Psk::Pskc::ComputePskcs(params, 4, pskcs[0]);
+    MEMCMP_EQUAL(expected, pskcs, sizeof(expected));
+}
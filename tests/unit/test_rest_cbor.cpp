@@ -0,0 +1,114 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "rest/cbor.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::rest::Cbor::Writer;
+
+static std::string Hex(const std::string &aBuffer)
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string       hex;
+
+    for (char c : aBuffer)
+    {
+        hex.push_back(kHexDigits[static_cast<uint8_t>(c) >> 4]);
+        hex.push_back(kHexDigits[static_cast<uint8_t>(c) & 0xf]);
+    }
+
+    return hex;
+}
+
+TEST_GROUP(RestCbor){};
+
+// The expected encodings are from Appendix A of RFC 8949.
+TEST(RestCbor, TestIntegers)
+{
+    const struct
+    {
+        int64_t     mValue;
+        const char *mEncoding;
+    } kCases[] = {
+        {0, "00"},
+        {23, "17"},
+        {24, "1818"},
+        {100, "1864"},
+        {1000, "1903e8"},
+        {1000000, "1a000f4240"},
+        {1000000000000, "1b000000e8d4a51000"},
+        {-1, "20"},
+        {-100, "3863"},
+        {-1000, "3903e7"},
+    };
+
+    for (const auto &testCase : kCases)
+    {
+        std::string buffer;
+
+        Writer(buffer).WriteInt(testCase.mValue);
+        STRCMP_EQUAL(testCase.mEncoding, Hex(buffer).c_str());
+    }
+}
+
+TEST(RestCbor, TestStringsAndContainers)
+{
+    const uint8_t kBytes[] = {0x01, 0x02, 0x03, 0x04};
+    std::string   buffer;
+    Writer        writer(buffer);
+
+    writer.WriteBytes(kBytes, sizeof(kBytes));
+    writer.WriteText("IETF");
+    writer.WriteBool(false);
+    writer.WriteBool(true);
+    STRCMP_EQUAL("44010203046449455446f4f5", Hex(buffer).c_str());
+
+    // {"a": 1, "b": [2, 3]}
+    buffer.clear();
+    writer.StartMap(2);
+    writer.WriteText("a");
+    writer.WriteUint(1);
+    writer.WriteText("b");
+    writer.StartArray(2);
+    writer.WriteUint(2);
+    writer.WriteUint(3);
+    STRCMP_EQUAL("a26161016162820203", Hex(buffer).c_str());
+
+    // {_ "Fun": true, "Amt": -2}
+    buffer.clear();
+    writer.StartIndefiniteMap();
+    writer.WriteText("Fun");
+    writer.WriteBool(true);
+    writer.WriteText("Amt");
+    writer.WriteInt(-2);
+    writer.EndIndefinite();
+    STRCMP_EQUAL("bf6346756ef563416d7421ff", Hex(buffer).c_str());
+}
@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "rest/request.hpp"
+#include "rest/router.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::StringView;
+using otbr::rest::HttpHeader;
+using otbr::rest::Request;
+using otbr::rest::Router;
+
+static void SetUrl(Request &aRequest, const char *aUrl)
+{
+    aRequest.Reset();
+    aRequest.SetUrl(aUrl, strlen(aUrl));
+}
+
+TEST_GROUP(RestRouter){};
+
+TEST(RestRouter, TestMatchLiteral)
+{
+    Router<int> router;
+    Request     request;
+
+    CHECK_TRUE(router.Add("/node", 1));
+    CHECK_TRUE(router.Add("/node/rloc16", 2));
+    CHECK_TRUE(router.Add("/", 3));
+    CHECK_FALSE(router.Add("/node/", 4));
+
+    SetUrl(request, "/node");
+    CHECK_EQUAL(1, *router.Match(request));
+
+    // Trailing slashes and the query are not part of the path.
+    SetUrl(request, "/node/rloc16/?pretty=true");
+    CHECK_EQUAL(2, *router.Match(request));
+
+    SetUrl(request, "/");
+    CHECK_EQUAL(3, *router.Match(request));
+
+    SetUrl(request, "/node/rloc");
+    CHECK_TRUE(router.Match(request) == nullptr);
+
+    SetUrl(request, "/node/rloc16/more");
+    CHECK_TRUE(router.Match(request) == nullptr);
+}
+
+TEST(RestRouter, TestMatchParameter)
+{
+    Router<int> router;
+    Request     request;
+    StringView  value;
+
+    CHECK_TRUE(router.Add("/diagnostics", 1));
+    CHECK_TRUE(router.Add("/diagnostics/{rloc16}", 2));
+    CHECK_TRUE(router.Add("/diagnostics/leader", 3));
+    CHECK_TRUE(router.Add("/networks/{network}/nodes/{node}", 4));
+
+    SetUrl(request, "/diagnostics/0x5800");
+    CHECK_EQUAL(2, *router.Match(request));
+    CHECK_TRUE(request.GetPathParameter("rloc16", value));
+    CHECK_TRUE(value == "0x5800");
+
+    // A literal segment takes precedence over a path parameter.
+    SetUrl(request, "/diagnostics/leader");
+    CHECK_EQUAL(3, *router.Match(request));
+    CHECK_FALSE(request.GetPathParameter("rloc16", value));
+
+    SetUrl(request, "/networks/home/nodes/42?stream=true");
+    CHECK_EQUAL(4, *router.Match(request));
+    CHECK_TRUE(request.GetPathParameter("network", value));
+    CHECK_TRUE(value == "home");
+    CHECK_TRUE(request.GetPathParameter("node", value));
+    CHECK_TRUE(value == "42");
+    CHECK_TRUE(request.GetQueryParameter("stream", value));
+    CHECK_TRUE(value == "true");
+
+    SetUrl(request, "/networks/home");
+    CHECK_TRUE(router.Match(request) == nullptr);
+}
+
+TEST(RestRouter, TestParseHeaders)
+{
+    Request request;
+
+    request.Reset();
+
+    // The parser may report the fields and values in several parts.
+    request.SetHeaderField("Acc", 3);
+    request.SetHeaderField("ept", 3);
+    request.SetHeaderValue("application/", 12);
+    request.SetHeaderValue("cbor", 4);
+    request.SetHeaderField("Host", 4);
+    request.SetHeaderValue("localhost", 9);
+    request.SetHeaderField("ACCEPT", 6);
+    request.SetHeaderValue("application/json", 16);
+    request.SetHeaderField("connection", 10);
+    request.SetHeaderValue("keep-alive", 10);
+
+    CHECK_TRUE(request.GetHeader(HttpHeader::kAccept) == "application/cbor, application/json");
+    CHECK_TRUE(request.GetHeader(HttpHeader::kConnection) == "keep-alive");
+    CHECK_TRUE(request.GetHeader(HttpHeader::kIfNoneMatch).empty());
+
+    request.Reset();
+    CHECK_TRUE(request.GetHeader(HttpHeader::kAccept).empty());
+}
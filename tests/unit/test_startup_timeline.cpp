@@ -0,0 +1,73 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/startup_timeline.hpp"
+
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(StartupTimeline){};
+
+TEST(StartupTimeline, TestRecordMilestones)
+{
+    otbr::StartupTimeline                        &timeline = otbr::StartupTimeline::GetInstance();
+    std::vector<otbr::StartupTimeline::Milestone> milestones;
+
+    timeline.Start();
+    timeline.Record("first");
+    std::this_thread::sleep_for(otbr::Milliseconds(20));
+    timeline.Record("second");
+    timeline.Record("first");
+
+    // A milestone is only recorded when it is first reached.
+    milestones = timeline.GetMilestones();
+    CHECK_EQUAL(2, milestones.size());
+    STRCMP_EQUAL("first", milestones[0].mName.c_str());
+    STRCMP_EQUAL("second", milestones[1].mName.c_str());
+    CHECK_TRUE(milestones[1].mElapsed - milestones[0].mElapsed >= otbr::Milliseconds(20));
+
+    // Starting the timeline again clears the milestones.
+    timeline.Start();
+    CHECK_TRUE(timeline.GetMilestones().empty());
+}
+
+TEST(StartupTimeline, TestRecordInThreads)
+{
+    otbr::StartupTimeline &timeline = otbr::StartupTimeline::GetInstance();
+
+    timeline.Start();
+
+    {
+        std::thread thread([&]() { timeline.Record("thread"); });
+
+        timeline.Record("main");
+        thread.join();
+    }
+
+    CHECK_EQUAL(2, timeline.GetMilestones().size());
+}
@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2023, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "common/worker_pool.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/task_runner.hpp"
+
+TEST_GROUP(WorkerPool){};
+
+TEST(WorkerPool, TestResultIsPostedBackToTaskRunner)
+{
+    otbr::TaskRunner taskRunner;
+    std::thread::id  mainThreadId = std::this_thread::get_id();
+    std::thread::id  workerThreadId;
+    std::string      result;
+    bool             done = false;
+
+    {
+        otbr::WorkerPool workerPool;
+
+        workerPool.Post([&]() {
+            std::string body = "serialized";
+
+            workerThreadId = std::this_thread::get_id();
+            taskRunner.Post([&, body]() {
+                CHECK_TRUE(std::this_thread::get_id() == mainThreadId);
+                result = body;
+                done   = true;
+            });
+        });
+
+        while (!done)
+        {
+            int                   rval;
+            otbr::MainloopContext mainloop;
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {10, 0};
+
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            taskRunner.Update(mainloop);
+            rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                          &mainloop.mTimeout);
+            CHECK_EQUAL(1, rval);
+
+            taskRunner.Process(mainloop);
+        }
+    }
+
+    CHECK_TRUE(workerThreadId != mainThreadId);
+    STRCMP_EQUAL("serialized", result.c_str());
+}
+
+TEST(WorkerPool, TestTasksOrder)
+{
+    std::string str;
+
+    {
+        otbr::WorkerPool workerPool;
+        std::atomic<int> counter{0};
+
+        workerPool.Post([&]() { str.push_back('a'); });
+        workerPool.Post([&]() { str.push_back('b'); });
+        workerPool.Post([&]() {
+            str.push_back('c');
+            ++counter;
+        });
+
+        while (counter.load() == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // A single worker executes the tasks in the order of posting.
+    STRCMP_EQUAL("abc", str.c_str());
+}
+
+TEST(WorkerPool, TestDestructorWaitsForRunningTasks)
+{
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+
+    {
+        otbr::WorkerPool workerPool(2);
+
+        workerPool.Post([&]() {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            finished = true;
+        });
+
+        while (!started.load())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    CHECK_TRUE(finished.load());
+}
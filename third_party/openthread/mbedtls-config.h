@@ -36,6 +36,11 @@
 #define MBEDTLS_HAVE_ASM
 #endif
 
+// Use the AES-NI instructions when the CPU supports them, which is detected at runtime
+#ifdef __x86_64__
+#define MBEDTLS_AESNI_C
+#endif
+
 #define MBEDTLS_AES_ROM_TABLES
 #define MBEDTLS_ECP_DP_SECP256R1_ENABLED
 #define MBEDTLS_ECP_NIST_OPTIM
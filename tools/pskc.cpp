@@ -34,6 +34,8 @@
 #include <stdio.h>
 #include <sysexits.h>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
@@ -52,19 +54,15 @@ void help(void)
 {
     printf("pskc - compute PSKc\n"
            "SYNTAX:\n"
-           "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME>\n"
+           "    pskc <PASSPHRASE> <EXTPANID> <NETWORK_NAME> [<PASSPHRASE> <EXTPANID> <NETWORK_NAME> ...]\n"
            "EXAMPLE:\n"
            "    pskc 654321 1122334455667788 OpenThread\n");
 }
 
-int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName)
+int parseParams(const char *aPassphrase, const char *aExtPanId, const char *aNetworkName, uint8_t *aExtPanIdBytes)
 {
-    uint8_t extpanid[kSizeExtPanId];
-    size_t  length;
-    int     ret = -1;
-
-    otbr::Psk::Pskc pskcComputer;
-    const uint8_t  *pskc;
+    size_t length;
+    int    ret = -1;
 
     length = strlen(aPassphrase);
     VerifyOrExit(length > 0, printf("PASSPHRASE must not be empty.\n"));
@@ -79,20 +77,47 @@ int printPSKc(const char *aPassphrase, const char *aExtPanId, const char *aNetwo
                          (aExtPanId[i] <= 'F' && aExtPanId[i] >= 'A'),
                      printf("EXTPANID must be encoded in hex.\n"));
     }
-    otbr::Utils::Hex2Bytes(aExtPanId, extpanid, sizeof(extpanid));
+    otbr::Utils::Hex2Bytes(aExtPanId, aExtPanIdBytes, kSizeExtPanId);
 
     length = strlen(aNetworkName);
     VerifyOrExit(length > 0, printf("NETWORK_NAME must not be empty.\n"));
     VerifyOrExit(length <= kMaxNetworkName,
                  printf("NETWOR_KNAME length must be no more than %d bytes.\n", kMaxNetworkName));
 
-    pskc = pskcComputer.ComputePskc(extpanid, aNetworkName, aPassphrase);
-    for (int i = 0; i < 16; i++)
+    ret = 0;
+
+exit:
+    return ret;
+}
+
+int printPSKcs(int aCount, char *aArgs[])
+{
+    std::vector<uint8_t>                 extpanids(aCount * kSizeExtPanId);
+    std::vector<otbr::Psk::Pskc::Params> params(aCount);
+    std::vector<uint8_t>                 pskcs(aCount * OT_PSKC_LENGTH);
+    int                                  ret = 0;
+
+    for (int i = 0; i < aCount; i++)
     {
-        printf("%02x", pskc[i]);
+        const char *passphrase  = aArgs[3 * i];
+        const char *extpanid    = aArgs[3 * i + 1];
+        const char *networkName = aArgs[3 * i + 2];
+
+        SuccessOrExit(ret = parseParams(passphrase, extpanid, networkName, &extpanids[i * kSizeExtPanId]));
+        params[i] = {&extpanids[i * kSizeExtPanId], networkName, passphrase};
+    }
+
+    // The PSKc of many networks are computed in parallel.
+    otbr::Psk::Pskc::ComputePskcs(params.data(), params.size(), pskcs.data());
+
+    for (int i = 0; i < aCount; i++)
+    {
+        for (int j = 0; j < OT_PSKC_LENGTH; j++)
+        {
+            printf("%02x", pskcs[i * OT_PSKC_LENGTH + j]);
+        }
+        printf("\n");
     }
-    printf("\n");
-    ret = 0;
 
 exit:
     return ret;
@@ -102,8 +127,8 @@ int main(int argc, char *argv[])
 {
     int ret = 0;
 
-    VerifyOrExit(argc == 4, help(), ret = EX_USAGE);
-    ret = printPSKc(argv[1], argv[2], argv[3]);
+    VerifyOrExit(argc >= 4 && (argc - 1) % 3 == 0, help(), ret = EX_USAGE);
+    ret = printPSKcs((argc - 1) / 3, &argv[1]);
 
 exit:
     return ret;